@@ -0,0 +1,142 @@
+#include "BloomFilter.h"
+
+#include <QString>
+#include <QtAlgorithms>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+const double LN2 = 0.69314718055994530942;
+
+// splitmix64 finalizer: spreads FNV output over all 64 bits
+quint64 mix(quint64 value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+double clampRate(double rate) { return min(0.5, max(0.0001, rate)); }
+
+double initialRate() {
+    bool ok = false;
+    double rate = QString::fromUtf8(qgetenv("TRIP_BLOOM_FPR")).toDouble(&ok);
+    return ok ? clampRate(rate) : DEFAULT_BLOOM_FALSE_POSITIVE_RATE;
+}
+
+atomic<double> bloomRateSelection(initialRate());
+
+}  // namespace
+
+// ========================================
+// BLOCKEDBLOOMFILTER
+// ========================================
+
+BLOCKEDBLOOMFILTER::BLOCKEDBLOOMFILTER(size_t expectedKeys, double falsePositiveRate) {
+    reset(expectedKeys, falsePositiveRate);
+}
+
+// FUNC: Size for the expected keys: m/n = -ln(p) / ln(2)^2 bits per key, k = m/n * ln(2) hashes
+void BLOCKEDBLOOMFILTER::reset(size_t expectedKeys, double falsePositiveRate) {
+    targetRate = clampRate(falsePositiveRate);
+    capacity = max<size_t>(expectedKeys, 1024);
+
+    double bitsPerKey = -log(targetRate) / (LN2 * LN2);
+    hashCount = static_cast<int>(min(16.0, max(1.0, round(bitsPerKey * LN2))));
+
+    // Blocking skews the load per block, which costs more the lower the target; a little extra keeps it on target
+    double blockingOverhead = 1.05 + 0.1 * max(0.0, -log10(targetRate) - 2.0);
+    size_t bits = static_cast<size_t>(ceil(capacity * bitsPerKey * blockingOverhead));
+    blocks.assign((bits + BLOOM_BLOCK_BITS - 1) / BLOOM_BLOCK_BITS, BLOCK());
+    for (BLOCK &block : blocks) {
+        memset(block.words, 0, sizeof(block.words));
+    }
+
+    keyCount = 0;
+    definiteMisses = 0;
+    falsePositives = 0;
+}
+
+// FUNC: The upper 32 bits pick the block (multiply-shift, no modulo)
+size_t BLOCKEDBLOOMFILTER::blockIndex(quint64 hash) const {
+    return static_cast<size_t>(((hash >> 32) * blocks.size()) >> 32);
+}
+
+// Bit positions inside the block: 9-bit slices of the remixed hash, remixed again every 7 slices
+void BLOCKEDBLOOMFILTER::add(quint64 hash) {
+    BLOCK &block = blocks[blockIndex(hash)];
+    quint64 bits = mix(hash);
+    for (int i = 0; i < hashCount; ++i) {
+        if (i > 0 && i % 7 == 0) bits = mix(bits);
+        quint32 bit = static_cast<quint32>(bits >> (9 * (i % 7))) & (BLOOM_BLOCK_BITS - 1);
+        block.words[bit >> 6] |= 1ULL << (bit & 63);
+    }
+    ++keyCount;
+}
+
+bool BLOCKEDBLOOMFILTER::mayContain(quint64 hash) const {
+    const BLOCK &block = blocks[blockIndex(hash)];
+    quint64 bits = mix(hash);
+    for (int i = 0; i < hashCount; ++i) {
+        if (i > 0 && i % 7 == 0) bits = mix(bits);
+        quint32 bit = static_cast<quint32>(bits >> (9 * (i % 7))) & (BLOOM_BLOCK_BITS - 1);
+        if ((block.words[bit >> 6] & (1ULL << (bit & 63))) == 0) {
+            ++definiteMisses;
+            return false;
+        }
+    }
+    return true;
+}
+
+void BLOCKEDBLOOMFILTER::recordFalsePositive() const { ++falsePositives; }
+
+bool BLOCKEDBLOOMFILTER::isOverCapacity() const { return keyCount > capacity; }
+
+size_t BLOCKEDBLOOMFILTER::getKeyCount() const { return keyCount; }
+
+BLOOMSTATS BLOCKEDBLOOMFILTER::getStats() const {
+    BLOOMSTATS stats;
+    stats.keys = keyCount;
+    stats.capacity = capacity;
+    stats.bits = blocks.size() * BLOOM_BLOCK_BITS;
+    stats.hashCount = hashCount;
+    stats.targetRate = targetRate;
+    stats.definiteMisses = definiteMisses;
+    stats.falsePositives = falsePositives;
+
+    // A lookup lands in one block, so the expected rate is the mean of fill^k over the blocks
+    double rateSum = 0.0;
+    for (const BLOCK &block : blocks) {
+        size_t bitsSet = 0;
+        for (quint64 word : block.words) {
+            bitsSet += qPopulationCount(word);
+        }
+        rateSum += pow(static_cast<double>(bitsSet) / BLOOM_BLOCK_BITS, hashCount);
+    }
+    stats.estimatedRate = blocks.empty() ? 0.0 : rateSum / blocks.size();
+    return stats;
+}
+
+// ========================================
+// KEY HASHING & CONFIGURATION
+// ========================================
+
+quint64 bloomHash(const string &key, quint64 seed) {
+    quint64 value = 1469598103934665603ULL ^ mix(seed + 1);
+    for (unsigned char c : key) {
+        value ^= c;
+        value *= 1099511628211ULL;
+    }
+    return mix(value);
+}
+
+double selectedBloomFalsePositiveRate() { return bloomRateSelection.load(); }
+
+void selectBloomFalsePositiveRate(double rate) { bloomRateSelection = clampRate(rate); }
@@ -0,0 +1,72 @@
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <QtGlobal>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const double DEFAULT_BLOOM_FALSE_POSITIVE_RATE = 0.01;
+static const size_t BLOOM_BLOCK_BITS = 512;  // One cache line per key
+
+// What a filter was sized for and how it is doing
+struct BLOOMSTATS {
+    size_t keys = 0;            // Added since the last reset, stale ones included
+    size_t capacity = 0;        // Keys the filter was sized for
+    size_t bits = 0;
+    int hashCount = 0;
+    double targetRate = 0.0;
+    double estimatedRate = 0.0;  // From the share of bits set
+    quint64 definiteMisses = 0;  // mayContain() answers of "never added"
+    quint64 falsePositives = 0;  // "maybe" answers the caller's exact check refuted
+
+    // Share of absent keys that were let through, as measured on real lookups
+    double observedRate() const {
+        quint64 absent = definiteMisses + falsePositives;
+        return absent > 0 ? static_cast<double>(falsePositives) / absent : 0.0;
+    }
+};
+
+// CLASS: BLOCKEDBLOOMFILTER - blocked Bloom filter over 64-bit key hashes
+// Every key sets all of its bits inside one 512-bit block, so a lookup touches a single cache line
+// instead of k random ones. A "no" is definite; a "maybe" still needs the exact check. Keys cannot
+// be removed: owners count stale keys and reset the filter once too many pile up.
+class BLOCKEDBLOOMFILTER {
+   private:
+    struct alignas(64) BLOCK {
+        quint64 words[BLOOM_BLOCK_BITS / 64];
+    };
+
+    vector<BLOCK> blocks;
+    size_t capacity;
+    size_t keyCount;
+    int hashCount;
+    double targetRate;
+    mutable quint64 definiteMisses;
+    mutable quint64 falsePositives;
+
+    size_t blockIndex(quint64 hash) const;
+
+   public:
+    explicit BLOCKEDBLOOMFILTER(size_t expectedKeys = 0, double falsePositiveRate = DEFAULT_BLOOM_FALSE_POSITIVE_RATE);
+
+    void reset(size_t expectedKeys, double falsePositiveRate);  // Empties the filter and resizes it
+    void add(quint64 hash);
+    bool mayContain(quint64 hash) const;  // false: the key was never added
+    void recordFalsePositive() const;     // Called when the exact check disagrees with a "maybe"
+
+    bool isOverCapacity() const;  // The target rate no longer holds
+    size_t getKeyCount() const;
+    BLOOMSTATS getStats() const;
+};
+
+// Seeds keep the key kinds (IDs, emails, phones) apart in one filter
+quint64 bloomHash(const string &key, quint64 seed);
+
+// Target false-positive rate for the duplicate pre-filters: --bloom-fpr or TRIP_BLOOM_FPR, 1% by default
+double selectedBloomFalsePositiveRate();
+void selectBloomFalsePositiveRate(double rate);  // Clamped to [0.0001, 0.5]
+
+#endif  // BLOOMFILTER_H
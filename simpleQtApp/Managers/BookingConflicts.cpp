@@ -0,0 +1,148 @@
+#include "BookingConflicts.h"
+
+#include <QMessageBox>
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+// One trip on one person's calendar
+struct BOOKING {
+    int startKey;
+    int endKey;
+    const TRIP *trip;
+};
+
+bool overlaps(const TRIP &a, const TRIP &b) {
+    return a.getStartDate().toKey() <= b.getEndDate().toKey() && b.getStartDate().toKey() <= a.getEndDate().toKey();
+}
+
+BOOKINGCONFLICT makeConflict(const string &personID, const TRIP &trip, const TRIP &other) {
+    BOOKINGCONFLICT conflict;
+    conflict.personID = personID;
+    conflict.tripID = trip.getID();
+    conflict.otherTripID = other.getID();
+    conflict.overlapStart = (trip.getStartDate() < other.getStartDate()) ? other.getStartDate() : trip.getStartDate();
+    conflict.overlapEnd = (trip.getEndDate() < other.getEndDate()) ? trip.getEndDate() : other.getEndDate();
+    return conflict;
+}
+
+// FUNC: Sweep one person's bookings; the heap holds the trips still running at the current start
+void sweepBookings(const string &personID, vector<BOOKING> &bookings, vector<BOOKINGCONFLICT> &conflicts) {
+    if (bookings.size() < 2) {
+        return;
+    }
+    sort(bookings.begin(), bookings.end(), [](const BOOKING &a, const BOOKING &b) {
+        return (a.startKey != b.startKey) ? a.startKey < b.startKey : a.endKey < b.endKey;
+    });
+
+    auto endsLater = [](const BOOKING &a, const BOOKING &b) { return a.endKey > b.endKey; };  // Min-heap on end
+    vector<BOOKING> active;
+    for (const BOOKING &booking : bookings) {
+        while (!active.empty() && active.front().endKey < booking.startKey) {
+            pop_heap(active.begin(), active.end(), endsLater);
+            active.pop_back();
+        }
+        for (const BOOKING &running : active) {
+            conflicts.push_back(makeConflict(personID, *booking.trip, *running.trip));
+        }
+        active.push_back(booking);
+        push_heap(active.begin(), active.end(), endsLater);
+    }
+}
+
+}  // namespace
+
+bool blocksBooking(const TRIP &trip) { return trip.getStatus() != STATUS::Cancelled; }
+
+// FUNC: Group bookings by person, then sweep each calendar
+vector<BOOKINGCONFLICT> findBookingConflicts(const TRIPMANAGER &tripManager) {
+    TRIPSNAPSHOT trips = tripManager.getAllTrips();  // Bookings point into it until the sweep is done
+    unordered_map<string, vector<BOOKING>> calendars;
+    for (const TRIP &trip : trips) {
+        if (!blocksBooking(trip)) continue;
+
+        BOOKING booking{trip.getStartDate().toKey(), trip.getEndDate().toKey(), &trip};
+        if (trip.hasHost()) {
+            calendars[trip.getHost().getID()].push_back(booking);
+        }
+        for (const MEMBER &member : trip.getMembers()) {
+            calendars[member.getID()].push_back(booking);
+        }
+    }
+
+    vector<BOOKINGCONFLICT> conflicts;
+    for (auto &calendar : calendars) {
+        sweepBookings(calendar.first, calendar.second, conflicts);
+    }
+    sort(conflicts.begin(), conflicts.end(), [](const BOOKINGCONFLICT &a, const BOOKINGCONFLICT &b) {
+        return (a.personID != b.personID) ? a.personID < b.personID : a.tripID < b.tripID;
+    });
+    return conflicts;
+}
+
+// FUNC: Compare the candidate with the other trips of each of its attendees
+vector<BOOKINGCONFLICT> findBookingConflicts(const TRIPMANAGER &tripManager, const TRIP &candidate,
+                                             const string &ignoreTripID) {
+    vector<BOOKINGCONFLICT> conflicts;
+    if (!blocksBooking(candidate)) {
+        return conflicts;
+    }
+
+    auto checkPerson = [&](const string &personID) {
+        const PERSONLINKS &links = tripManager.getTripsOfPerson(personID);
+        for (const vector<string> *tripIDs : {&links.hostedTripIDs, &links.joinedTripIDs}) {
+            for (const string &tripID : *tripIDs) {
+                if (tripID == ignoreTripID) continue;
+
+                const TRIP *other = tripManager.findTripById(tripID);
+                if (other && blocksBooking(*other) && overlaps(candidate, *other)) {
+                    conflicts.push_back(makeConflict(personID, candidate, *other));
+                }
+            }
+        }
+    };
+
+    if (candidate.hasHost()) {
+        checkPerson(candidate.getHost().getID());
+    }
+    for (const MEMBER &member : candidate.getMembers()) {
+        checkPerson(member.getID());
+    }
+    return conflicts;
+}
+
+string describeBookingConflicts(const vector<BOOKINGCONFLICT> &conflicts, size_t maxLines) {
+    string text;
+    size_t shown = min(conflicts.size(), maxLines);
+    for (size_t i = 0; i < shown; ++i) {
+        const BOOKINGCONFLICT &conflict = conflicts[i];
+        text += conflict.personID + ": " + conflict.tripID + " overlaps " + conflict.otherTripID + " (" +
+                conflict.overlapStart.toString() + " - " + conflict.overlapEnd.toString() + ")\n";
+    }
+    if (conflicts.size() > shown) {
+        text += "... and " + to_string(conflicts.size() - shown) + " more\n";
+    }
+    return text;
+}
+
+bool confirmBookingConflicts(QWidget *parent, const TRIPMANAGER *tripManager, const TRIP &candidate,
+                             const string &ignoreTripID) {
+    if (!tripManager) {
+        return true;
+    }
+
+    vector<BOOKINGCONFLICT> conflicts = findBookingConflicts(*tripManager, candidate, ignoreTripID);
+    if (conflicts.empty()) {
+        return true;
+    }
+
+    QString details = QString::fromStdString(describeBookingConflicts(conflicts));
+    int answer = QMessageBox::question(
+        parent, "Booking Conflict",
+        QString("The host or members are already booked on overlapping trips:\n\n%1\nSave it anyway?").arg(details),
+        QMessageBox::Yes | QMessageBox::No, QMessageBox::No);
+    return answer == QMessageBox::Yes;
+}
@@ -0,0 +1,43 @@
+#ifndef BOOKINGCONFLICTS_H
+#define BOOKINGCONFLICTS_H
+
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "TripManager.h"
+
+using namespace std;
+
+class QWidget;
+
+// One person booked on two trips whose dates overlap (both ends inclusive)
+struct BOOKINGCONFLICT {
+    string personID;
+    string tripID;       // The trip being checked, or the later-starting trip in a full scan
+    string otherTripID;  // The trip it collides with
+    DATE overlapStart;
+    DATE overlapEnd;
+};
+
+// Cancelled trips free their attendees; every other status holds the dates
+bool blocksBooking(const TRIP &trip);
+
+// Full scan: each person's trips sorted by start date and swept once, so the cost is
+// O(n log n) in the number of bookings plus one step per conflict reported.
+vector<BOOKINGCONFLICT> findBookingConflicts(const TRIPMANAGER &tripManager);
+
+// Incremental check for a trip about to be saved: only the trips the relationship index links to
+// its host and members are compared. ignoreTripID is the stored version of a trip being edited.
+vector<BOOKINGCONFLICT> findBookingConflicts(const TRIPMANAGER &tripManager, const TRIP &candidate,
+                                             const string &ignoreTripID = "");
+
+// One line per conflict for message boxes and logs, "... and N more" past maxLines
+string describeBookingConflicts(const vector<BOOKINGCONFLICT> &conflicts, size_t maxLines = 10);
+
+// Asks before saving a trip that double-books its host or members; true when there is nothing to
+// ask or the user goes ahead. Shared by the add and edit dialogs.
+bool confirmBookingConflicts(QWidget *parent, const TRIPMANAGER *tripManager, const TRIP &candidate,
+                             const string &ignoreTripID = "");
+
+#endif  // BOOKINGCONFLICTS_H
@@ -0,0 +1,375 @@
+#include "CsvWriter.h"
+
+#include <QElapsedTimer>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+const char *const TRIP_CSV_HEADER = "ID,Destination,Description,StartDate,EndDate,Status,HostID,MemberIDs";
+const char *const PEOPLE_CSV_HEADER =
+    "FullName,DOB,Email,Phone,Gender,Address,Role,EmergencyContact,Interests,TotalSpent";
+
+namespace {
+
+// Same text as statusToString/genderToString, without a string per row
+const char *statusName(STATUS status) {
+    switch (status) {
+        case STATUS::Planned:
+            return "Planned";
+        case STATUS::Ongoing:
+            return "Ongoing";
+        case STATUS::Completed:
+            return "Completed";
+        case STATUS::Cancelled:
+            return "Cancelled";
+        default:
+            return "Unknown";
+    }
+}
+
+const char *genderName(GENDER gender) { return gender == GENDER::Female ? "Female" : "Male"; }
+
+bool needsQuoting(const char *data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        char c = data[i];
+        if (c == ',' || c == '"' || c == '\n' || c == '\r') {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+// ========================================
+// CSVWRITER
+// ========================================
+
+CSVWRITER::CSVWRITER(const string &filePath, bool replaceAtomically, size_t bufferSize)
+    : path(filePath),
+      writePath(replaceAtomically ? filePath + ".part" : filePath),
+      replaceAtomically(replaceAtomically),
+      bufferLimit(bufferSize),
+      bytesWritten(0),
+      rowStarted(false),
+      failed(false) {
+    output.open(writePath, ios::out | ios::binary | ios::trunc);
+    if (!output.is_open()) {
+        throw runtime_error("Cannot open file for writing: " + filePath);
+    }
+    buffer.reserve(bufferLimit + 4096);
+}
+
+CSVWRITER::~CSVWRITER() {
+    if (!output.is_open()) {
+        return;
+    }
+    if (replaceAtomically) {
+        discard();  // Never publish a file nobody closed
+    } else {
+        close();
+    }
+}
+
+void CSVWRITER::separator() {
+    if (rowStarted) {
+        buffer += ',';
+    }
+    rowStarted = true;
+}
+
+void CSVWRITER::appendDigits(unsigned long long value, int minWidth) {
+    char digits[24];
+    int count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (count < minWidth) {
+        digits[count++] = '0';
+    }
+    while (count > 0) {
+        buffer += digits[--count];
+    }
+}
+
+// FUNC: Hand the buffer to the stream once it is past the limit (only between rows)
+void CSVWRITER::flushIfFull() {
+    if (buffer.size() < bufferLimit) {
+        return;
+    }
+    output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+    failed = failed || !output.good();
+    bytesWritten += buffer.size();
+    buffer.clear();
+}
+
+void CSVWRITER::header(const char *line) {
+    buffer += line;
+    buffer += '\n';
+    rowStarted = false;
+}
+
+void CSVWRITER::field(const string &value) {
+    separator();
+    if (!needsQuoting(value.data(), value.size())) {
+        buffer += value;
+        return;
+    }
+
+    buffer += '"';
+    for (char c : value) {
+        if (c == '"') buffer += '"';  // RFC 4180: quotes are doubled
+        buffer += c;
+    }
+    buffer += '"';
+}
+
+void CSVWRITER::field(const char *value) {
+    size_t size = strlen(value);
+    if (needsQuoting(value, size)) {
+        field(string(value, size));
+        return;
+    }
+    separator();
+    buffer.append(value, size);
+}
+
+void CSVWRITER::field(long long value) {
+    separator();
+    if (value < 0) {
+        buffer += '-';
+        appendDigits(0ULL - static_cast<unsigned long long>(value), 1);
+    } else {
+        appendDigits(static_cast<unsigned long long>(value), 1);
+    }
+}
+
+void CSVWRITER::field(size_t value) {
+    separator();
+    appendDigits(value, 1);
+}
+
+void CSVWRITER::field(double value) {
+    separator();
+    char text[32];
+    int written = snprintf(text, sizeof(text), "%g", value);  // ostream's default formatting
+    if (written > 0) {
+        buffer.append(text, min(static_cast<size_t>(written), sizeof(text) - 1));
+    }
+}
+
+void CSVWRITER::field(const DATE &date) {
+    separator();
+    appendDigits(static_cast<unsigned long long>(date.getDay()), 2);
+    buffer += '/';
+    appendDigits(static_cast<unsigned long long>(date.getMonth()), 2);
+    buffer += '/';
+    appendDigits(static_cast<unsigned long long>(date.getYear()), 2);
+}
+
+void CSVWRITER::emptyField() { separator(); }
+
+void CSVWRITER::endRow() {
+    buffer += '\n';
+    rowStarted = false;
+    flushIfFull();
+}
+
+bool CSVWRITER::close() {
+    if (!output.is_open()) {
+        return !failed;  // Already closed or discarded
+    }
+    if (!buffer.empty()) {
+        output.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        bytesWritten += buffer.size();
+        buffer.clear();
+    }
+    output.close();
+    failed = failed || output.fail();
+
+    if (replaceAtomically) {
+        if (failed) {
+            remove(writePath.c_str());
+            return false;
+        }
+        // rename() replaces the target in one step on POSIX; Windows wants the target gone first
+        if (rename(writePath.c_str(), path.c_str()) != 0) {
+            remove(path.c_str());
+            if (rename(writePath.c_str(), path.c_str()) != 0) {
+                remove(writePath.c_str());
+                failed = true;
+            }
+        }
+    }
+    return !failed;
+}
+
+void CSVWRITER::discard() {
+    buffer.clear();
+    if (output.is_open()) {
+        output.close();
+    }
+    if (replaceAtomically) {
+        remove(writePath.c_str());
+    }
+}
+
+quint64 CSVWRITER::getBytesWritten() const { return bytesWritten + buffer.size(); }
+
+// ========================================
+// ROW LAYOUTS
+// ========================================
+
+void writeTripRow(CSVWRITER &writer, const TRIP &trip) {
+    writer.field(trip.getID());
+    writer.field(trip.getDestination());
+    writer.field(trip.getDescription());
+    writer.field(trip.getStartDate());
+    writer.field(trip.getEndDate());
+    writer.field(statusName(trip.getStatus()));
+    writer.field(trip.getHost().getID());
+    writer.joinedField(trip.getMembers(), ';', [](const MEMBER &member) -> const string & { return member.getID(); });
+    writer.endRow();
+}
+
+void writeMemberRow(CSVWRITER &writer, const MEMBER &member) {
+    writer.field(member.getFullName());
+    writer.field(member.getDateOfBirth());
+    writer.field(member.getEmail());
+    writer.field(member.getPhoneNumber());
+    writer.field(genderName(member.getGender()));
+    writer.field(member.getAddress());
+    writer.field("Member");
+    writer.field(member.getEmergencyContact());
+    writer.joinedField(member.getInterests(), ';', [](const string &interest) -> const string & { return interest; });
+    writer.field(member.getTotalSpent());
+    writer.endRow();
+}
+
+void writeHostRow(CSVWRITER &writer, const HOST &host) {
+    writer.field(host.getFullName());
+    writer.field(host.getDateOfBirth());
+    writer.field(host.getEmail());
+    writer.field(host.getPhoneNumber());
+    writer.field(genderName(host.getGender()));
+    writer.field(host.getAddress());
+    writer.field("Host");
+    writer.field(host.getEmergencyContact());
+    writer.emptyField();  // No interests or spending for hosts
+    writer.emptyField();
+    writer.endRow();
+}
+
+// FUNC: Split a CSV line; a quote inside a quoted field is written as ""
+void splitCsvLine(const string &line, vector<string> &fields) {
+    fields.clear();
+    string field;
+    bool inQuotes = false;
+
+    for (size_t i = 0; i < line.size(); ++i) {
+        char c = line[i];
+        if (c == '"') {
+            if (inQuotes && i + 1 < line.size() && line[i + 1] == '"') {
+                field += '"';
+                ++i;
+            } else {
+                inQuotes = !inQuotes;
+            }
+        } else if (c == ',' && !inQuotes) {
+            fields.push_back(field);
+            field.clear();
+        } else if (c != '\r' || inQuotes) {
+            field += c;
+        }
+    }
+    fields.push_back(field);
+}
+
+// ========================================
+// BENCHMARK
+// ========================================
+
+namespace {
+
+vector<TRIP> makeBenchmarkTrips(size_t tripCount) {
+    static const char *const destinations[] = {"HA NOI", "DA NANG", "HUE", "SAPA", "PHU QUOC", "HA LONG"};
+    const size_t membersPerTrip = 6;
+
+    vector<MEMBER> members;
+    for (size_t i = 0; i < 64; ++i) {
+        members.emplace_back("M" + to_string(100000 + i), "MEMBER " + to_string(i), GENDER::Female,
+                             DATE(1 + i % 28, 1 + i % 12, 1990));
+    }
+    HOST host("H100001", "HOST ONE", GENDER::Male, DATE(1, 1, 1980));
+
+    vector<TRIP> trips;
+    trips.reserve(tripCount);
+    for (size_t i = 0; i < tripCount; ++i) {
+        TRIP trip("T" + to_string(1000000 + i), destinations[i % 6],
+                  (i % 4 == 0) ? "Guided tour, meals included" : "Self-guided trip with a local host",
+                  DATE(1 + i % 28, 1 + i % 12, 2024), DATE(1 + (i + 3) % 28, 1 + i % 12, 2024),
+                  static_cast<STATUS>(i % 4));
+        trip.setHost(host);
+        for (size_t m = 0; m < membersPerTrip; ++m) {
+            trip.addMember(members[(i + m) % members.size()]);
+        }
+        trips.push_back(trip);
+    }
+    return trips;
+}
+
+// The per-value ostream export this writer replaced, kept only as the benchmark baseline
+void writeWithStream(const vector<TRIP> &trips, const string &filePath) {
+    ofstream output(filePath);
+    output << TRIP_CSV_HEADER << "\n";
+    for (const TRIP &trip : trips) {
+        output << trip.getID() << "," << trip.getDestination() << "," << trip.getDescription() << ","
+               << trip.getStartDate().toString() << "," << trip.getEndDate().toString() << ","
+               << statusToString(trip.getStatus()) << ",";
+        HOST host = trip.getHost();
+        if (!host.getID().empty()) {
+            output << host.getID();
+        }
+        output << ",";
+        vector<MEMBER> members = trip.getMembers();
+        for (size_t i = 0; i < members.size(); ++i) {
+            if (i > 0) output << ";";
+            output << members[i].getID();
+        }
+        output << "\n";
+    }
+}
+
+}  // namespace
+
+// FUNC: Write the same synthetic trips with both exporters and time them
+CSVBENCHRESULT benchmarkCsvExport(size_t tripCount, const string &directory) {
+    CSVBENCHRESULT result;
+    result.tripCount = tripCount;
+    vector<TRIP> trips = makeBenchmarkTrips(tripCount);
+
+    string streamPath = directory + "/bench_stream.csv";
+    string writerPath = directory + "/bench_writer.csv";
+    QElapsedTimer timer;
+
+    timer.start();
+    writeWithStream(trips, streamPath);
+    result.streamMs = timer.elapsed();
+
+    timer.restart();
+    CSVWRITER writer(writerPath);
+    writer.header(TRIP_CSV_HEADER);
+    for (const TRIP &trip : trips) {
+        writeTripRow(writer, trip);
+    }
+    writer.close();
+    result.writerMs = timer.elapsed();
+    result.bytes = writer.getBytesWritten();
+
+    remove(streamPath.c_str());
+    remove(writerPath.c_str());
+    return result;
+}
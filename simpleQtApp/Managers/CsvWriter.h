@@ -0,0 +1,101 @@
+#ifndef CSVWRITER_H
+#define CSVWRITER_H
+
+#include <QtGlobal>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+static const size_t CSV_WRITER_BUFFER = 1 << 20;  // Bytes collected before each write to disk
+
+// CLASS: CSVWRITER - buffered RFC-4180 writer shared by every CSV export and cache save
+// Rows are assembled in one reusable buffer; numbers and dates are formatted straight into it.
+// Text fields are only quoted when they contain a comma, a quote or a line break.
+// With replaceAtomically the rows go to "<path>.part", renamed over the target by close();
+// a writer destroyed or discarded before that leaves the target untouched.
+class CSVWRITER {
+   private:
+    ofstream output;
+    string path;
+    string writePath;  // path, or the temp file when replacing atomically
+    bool replaceAtomically;
+    string buffer;
+    string scratch;  // Reused for joined fields (member IDs, interests)
+    size_t bufferLimit;
+    quint64 bytesWritten;
+    bool rowStarted;
+    bool failed;
+
+    void separator();
+    void appendDigits(unsigned long long value, int minWidth);
+    void flushIfFull();
+
+   public:
+    // Throws if the file cannot be created
+    explicit CSVWRITER(const string &filePath, bool replaceAtomically = false, size_t bufferSize = CSV_WRITER_BUFFER);
+    ~CSVWRITER();
+
+    CSVWRITER(const CSVWRITER &) = delete;
+    CSVWRITER &operator=(const CSVWRITER &) = delete;
+
+    void header(const char *line);  // Trusted text, written as is followed by a line break
+
+    void field(const string &value);
+    void field(const char *value);
+    void field(long long value);
+    void field(int value) { field(static_cast<long long>(value)); }
+    void field(size_t value);
+    void field(double value);
+    void field(const DATE &date);  // DD/MM/YYYY, like DATE::toString
+    void emptyField();
+
+    // One field made of several values joined by separatorChar, quoted as a whole if needed
+    template <typename Range, typename Getter>
+    void joinedField(const Range &values, char separatorChar, Getter get) {
+        scratch.clear();
+        bool first = true;
+        for (const auto &value : values) {
+            if (!first) scratch += separatorChar;
+            scratch += get(value);
+            first = false;
+        }
+        field(scratch);
+    }
+
+    void endRow();
+
+    bool close();    // Flushes what is left (and renames into place); false if any write failed
+    void discard();  // Atomic mode: drops the temp file
+    quint64 getBytesWritten() const;
+};
+
+// Row layouts shared by the exports and the caches
+extern const char *const TRIP_CSV_HEADER;
+extern const char *const PEOPLE_CSV_HEADER;
+
+void writeTripRow(CSVWRITER &writer, const TRIP &trip);
+void writeMemberRow(CSVWRITER &writer, const MEMBER &member);
+void writeHostRow(CSVWRITER &writer, const HOST &host);
+
+// Splits one CSV line, honouring quoted fields and doubled quotes ("")
+void splitCsvLine(const string &line, vector<string> &fields);
+
+// Result of --bench-csv: the same synthetic trips written both ways
+struct CSVBENCHRESULT {
+    size_t tripCount = 0;
+    quint64 bytes = 0;
+    qint64 streamMs = 0;  // ofstream << per value, the pre-CSVWRITER export code
+    qint64 writerMs = 0;
+
+    double streamMBps() const { return streamMs > 0 ? bytes / 1048576.0 / (streamMs / 1000.0) : 0.0; }
+    double writerMBps() const { return writerMs > 0 ? bytes / 1048576.0 / (writerMs / 1000.0) : 0.0; }
+};
+
+CSVBENCHRESULT benchmarkCsvExport(size_t tripCount, const string &directory);
+
+#endif  // CSVWRITER_H
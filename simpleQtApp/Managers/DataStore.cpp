@@ -0,0 +1,203 @@
+#include "DataStore.h"
+
+#include <QFileInfo>
+#include <atomic>
+#include <fstream>
+
+#include "FileManager.h"
+#include "Logger.h"
+#include "SqliteStorage.h"
+
+using namespace std;
+
+// ========================================
+// CSV BACKEND
+// ========================================
+
+CSVTRIPSTORE::CSVTRIPSTORE(const QString &csvPath) : csvPath(csvPath) {}
+
+string CSVTRIPSTORE::getName() const { return "csv"; }
+
+bool CSVTRIPSTORE::load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) {
+    std::ifstream file(csvPath.toStdString());
+    if (!file.is_open()) {
+        LOG_INFO("No trip cache found at:", csvPath);
+        return false;
+    }
+
+    string line;
+    bool firstLine = true;
+    TRIP trip;
+    TRIPATTENDEEIDS ids;
+
+    while (std::getline(file, line)) {
+        if (firstLine) {
+            firstLine = false;
+            if (line.find("ID") != string::npos || line.find("Destination") != string::npos) {
+                continue;  // Header
+            }
+        }
+        if (line.empty()) continue;
+
+        if (parseTripCacheLine(line, trip, ids.hostID, ids.memberIDs)) {
+            trips.push_back(move(trip));
+            attendees.push_back(move(ids));
+        }
+    }
+    return true;
+}
+
+bool CSVTRIPSTORE::saveSnapshot(const vector<TRIP> &trips) {
+    try {
+        saveTripAttendeesToCache(trips, csvPath.toStdString());
+        return true;
+    } catch (const exception &e) {
+        LOG_ERROR("Error updating trip cache:", e.what());
+        return false;
+    }
+}
+
+CSVPERSONSTORE::CSVPERSONSTORE(const QString &csvPath) : csvPath(csvPath) {}
+
+string CSVPERSONSTORE::getName() const { return "csv"; }
+
+bool CSVPERSONSTORE::load(vector<MEMBER> &members, vector<HOST> &hosts) {
+    if (!QFileInfo(csvPath).exists()) {
+        LOG_INFO("No people cache found at:", csvPath);
+        return false;
+    }
+
+    try {
+        importPeopleInfo(members, hosts, csvPath.toStdString());
+        return true;
+    } catch (const exception &e) {
+        LOG_ERROR("Error loading people cache:", e.what());
+        return false;
+    }
+}
+
+bool CSVPERSONSTORE::saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) {
+    try {
+        exportPeopleInfo(members, hosts, csvPath.toStdString());
+        return true;
+    } catch (const exception &e) {
+        LOG_ERROR("Error updating people cache:", e.what());
+        return false;
+    }
+}
+
+// ========================================
+// BINARY SNAPSHOT BACKEND
+// ========================================
+
+BINARYTRIPSTORE::BINARYTRIPSTORE(const QString &csvPath, bool compressed)
+    : CSVTRIPSTORE(csvPath), compressed(compressed) {}
+
+string BINARYTRIPSTORE::getName() const { return compressed ? "compressed" : "binary"; }
+
+bool BINARYTRIPSTORE::load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) {
+    if (loadTripSnapshot(csvPath, trips, attendees)) {
+        return true;
+    }
+    trips.clear();
+    attendees.clear();
+    return CSVTRIPSTORE::load(trips, attendees);
+}
+
+bool BINARYTRIPSTORE::saveSnapshot(const vector<TRIP> &trips) {
+    // Snapshot is stamped with the CSV it was written from, so the CSV goes first
+    return CSVTRIPSTORE::saveSnapshot(trips) && writeTripSnapshot(trips, csvPath, compressed);
+}
+
+BINARYPERSONSTORE::BINARYPERSONSTORE(const QString &csvPath, bool compressed)
+    : CSVPERSONSTORE(csvPath), compressed(compressed) {}
+
+string BINARYPERSONSTORE::getName() const { return compressed ? "compressed" : "binary"; }
+
+bool BINARYPERSONSTORE::load(vector<MEMBER> &members, vector<HOST> &hosts) {
+    if (loadPeopleSnapshot(csvPath, members, hosts)) {
+        return true;
+    }
+    members.clear();
+    hosts.clear();
+    return CSVPERSONSTORE::load(members, hosts);
+}
+
+bool BINARYPERSONSTORE::saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) {
+    return CSVPERSONSTORE::saveSnapshot(members, hosts) && writePeopleSnapshot(members, hosts, csvPath, compressed);
+}
+
+// ========================================
+// BACKEND SELECTION
+// ========================================
+
+static atomic<int> backendSelection(-1);  // -1 = not decided yet, read the environment
+
+bool parseStorageBackend(const QString &name, STORAGEBACKEND &backend) {
+    QString key = name.trimmed().toLower();
+    if (key == "csv") {
+        backend = STORAGEBACKEND::Csv;
+    } else if (key == "binary") {
+        backend = STORAGEBACKEND::Binary;
+    } else if (key == "sqlite") {
+        backend = STORAGEBACKEND::Sqlite;
+    } else if (key == "compressed") {
+        backend = STORAGEBACKEND::Compressed;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+QString storageBackendName(STORAGEBACKEND backend) {
+    switch (backend) {
+        case STORAGEBACKEND::Csv:
+            return "csv";
+        case STORAGEBACKEND::Sqlite:
+            return "sqlite";
+        case STORAGEBACKEND::Compressed:
+            return "compressed";
+        default:
+            return "binary";
+    }
+}
+
+STORAGEBACKEND selectedStorageBackend() {
+    if (backendSelection < 0) {
+        STORAGEBACKEND backend = STORAGEBACKEND::Binary;
+        QString fromEnvironment = QString::fromUtf8(qgetenv("TRIP_STORAGE"));
+        if (!fromEnvironment.isEmpty() && !parseStorageBackend(fromEnvironment, backend)) {
+            LOG_WARNING("Unknown TRIP_STORAGE value", fromEnvironment, "- using the binary cache");
+        }
+        backendSelection = static_cast<int>(backend);
+    }
+    return static_cast<STORAGEBACKEND>(backendSelection.load());
+}
+
+void selectStorageBackend(STORAGEBACKEND backend) { backendSelection = static_cast<int>(backend); }
+
+unique_ptr<TRIPSTORE> createTripStore(STORAGEBACKEND backend) {
+    switch (backend) {
+        case STORAGEBACKEND::Csv:
+            return unique_ptr<TRIPSTORE>(new CSVTRIPSTORE(getCacheFilePath()));
+        case STORAGEBACKEND::Sqlite:
+            return unique_ptr<TRIPSTORE>(new SQLITETRIPSTORE(SQLITESTORAGE::defaultDatabasePath()));
+        case STORAGEBACKEND::Compressed:
+            return unique_ptr<TRIPSTORE>(new BINARYTRIPSTORE(getCacheFilePath(), true));
+        default:
+            return unique_ptr<TRIPSTORE>(new BINARYTRIPSTORE(getCacheFilePath()));
+    }
+}
+
+unique_ptr<PERSONSTORE> createPersonStore(STORAGEBACKEND backend) {
+    switch (backend) {
+        case STORAGEBACKEND::Csv:
+            return unique_ptr<PERSONSTORE>(new CSVPERSONSTORE(getPeopleCacheFilePath()));
+        case STORAGEBACKEND::Sqlite:
+            return unique_ptr<PERSONSTORE>(new SQLITEPERSONSTORE(SQLITESTORAGE::defaultDatabasePath()));
+        case STORAGEBACKEND::Compressed:
+            return unique_ptr<PERSONSTORE>(new BINARYPERSONSTORE(getPeopleCacheFilePath(), true));
+        default:
+            return unique_ptr<PERSONSTORE>(new BINARYPERSONSTORE(getPeopleCacheFilePath()));
+    }
+}
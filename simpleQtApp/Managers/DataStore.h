@@ -0,0 +1,160 @@
+#ifndef DATASTORE_H
+#define DATASTORE_H
+
+#include <QString>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "SnapshotFile.h"
+#include "TripCollection.h"
+
+using namespace std;
+
+// Changes since the last write, for backends that can persist single records
+struct TRIPDELTA {
+    vector<TRIP> upserted;
+    vector<string> removedIDs;
+
+    bool empty() const { return upserted.empty() && removedIDs.empty(); }
+};
+
+struct PERSONDELTA {
+    vector<MEMBER> upsertedMembers;
+    vector<HOST> upsertedHosts;
+    vector<string> removedIDs;
+
+    bool empty() const { return upsertedMembers.empty() && upsertedHosts.empty() && removedIDs.empty(); }
+};
+
+// Filter criteria that a store may evaluate itself (mirrors FilterTripDialog)
+// Only exact and case-sensitive text criteria: SQL case folding stops at ASCII, so case-insensitive
+// searches stay with the caller's Unicode-aware matching.
+struct TRIPQUERY {
+    string destinationEquals;  // Dropdown selection, exact and case-sensitive
+    set<STATUS> statuses;
+    vector<string> descriptionKeywords;  // Any keyword matches, case-sensitive
+    bool dateFilter = false;
+    int startFrom = 0, startTo = 0, endFrom = 0, endTo = 0;  // YYYYMMDD, inclusive
+    int sortBy = 0;  // Same order as the dialog's sort combo box
+    bool ascending = true;
+};
+
+// CLASS: TRIPSTORE - persistence backend for TRIPMANAGER's trips
+// Stores never talk to the user: failures are logged and reported through the return value.
+class TRIPSTORE {
+   public:
+    virtual ~TRIPSTORE() = default;
+
+    virtual string getName() const = 0;
+
+    // Attendees come back as IDs and are resolved against PERSONMANAGER by the caller
+    virtual bool load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) = 0;
+    virtual bool saveSnapshot(const vector<TRIP> &trips) = 0;
+
+    // Whole-file backends have nothing better than rewriting the current state
+    virtual bool applyDelta(const TRIPDELTA &delta, const TRIPSNAPSHOT &current) {
+        (void)delta;
+        return saveSnapshot(current.toVector());
+    }
+
+    virtual bool flush() { return true; }
+
+    // Filter pushdown, only offered when the store holds exactly the loaded trips: the same count
+    // and nothing unsaved (a failed write leaves the store behind)
+    virtual bool canQuery(size_t loadedTripCount, bool hasUnsavedChanges) {
+        (void)loadedTripCount;
+        (void)hasUnsavedChanges;
+        return false;
+    }
+    virtual vector<string> queryTripIDs(const TRIPQUERY &query) {
+        (void)query;
+        return {};
+    }
+};
+
+// CLASS: PERSONSTORE - persistence backend for PERSONMANAGER's members and hosts
+class PERSONSTORE {
+   public:
+    virtual ~PERSONSTORE() = default;
+
+    virtual string getName() const = 0;
+
+    virtual bool load(vector<MEMBER> &members, vector<HOST> &hosts) = 0;
+    virtual bool saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) = 0;
+
+    virtual bool applyDelta(const PERSONDELTA &delta, const vector<MEMBER> &members, const vector<HOST> &hosts) {
+        (void)delta;
+        return saveSnapshot(members, hosts);
+    }
+
+    virtual bool flush() { return true; }
+};
+
+// CLASS: CSVTRIPSTORE / CSVPERSONSTORE - cache.csv and people_cache.csv, parsed on every load
+class CSVTRIPSTORE : public TRIPSTORE {
+   protected:
+    QString csvPath;
+
+   public:
+    explicit CSVTRIPSTORE(const QString &csvPath);
+
+    string getName() const override;
+    bool load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) override;
+    bool saveSnapshot(const vector<TRIP> &trips) override;
+};
+
+class CSVPERSONSTORE : public PERSONSTORE {
+   protected:
+    QString csvPath;
+
+   public:
+    explicit CSVPERSONSTORE(const QString &csvPath);
+
+    string getName() const override;
+    bool load(vector<MEMBER> &members, vector<HOST> &hosts) override;
+    bool saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) override;
+};
+
+// CLASS: BINARYTRIPSTORE / BINARYPERSONSTORE - the CSV caches plus their binary snapshot
+// The CSV stays the file of record; loads take the snapshot while it matches the CSV.
+// With compressed set the snapshot is written block-compressed; either kind loads.
+class BINARYTRIPSTORE : public CSVTRIPSTORE {
+   private:
+    bool compressed;
+
+   public:
+    explicit BINARYTRIPSTORE(const QString &csvPath, bool compressed = false);
+
+    string getName() const override;
+    bool load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) override;
+    bool saveSnapshot(const vector<TRIP> &trips) override;
+};
+
+class BINARYPERSONSTORE : public CSVPERSONSTORE {
+   private:
+    bool compressed;
+
+   public:
+    explicit BINARYPERSONSTORE(const QString &csvPath, bool compressed = false);
+
+    string getName() const override;
+    bool load(vector<MEMBER> &members, vector<HOST> &hosts) override;
+    bool saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) override;
+};
+
+// FUNC: Backend selection, decided once at startup
+enum class STORAGEBACKEND { Csv, Binary, Sqlite, Compressed };
+
+bool parseStorageBackend(const QString &name, STORAGEBACKEND &backend);
+QString storageBackendName(STORAGEBACKEND backend);
+STORAGEBACKEND selectedStorageBackend();  // --storage=... or TRIP_STORAGE, Binary otherwise
+void selectStorageBackend(STORAGEBACKEND backend);
+
+// Every store owns its own handles, so create one per thread that uses it
+unique_ptr<TRIPSTORE> createTripStore(STORAGEBACKEND backend);
+unique_ptr<PERSONSTORE> createPersonStore(STORAGEBACKEND backend);
+
+#endif  // DATASTORE_H
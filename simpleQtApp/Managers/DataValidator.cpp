@@ -0,0 +1,329 @@
+#include "DataValidator.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <unordered_set>
+
+#include "IdAllocator.h"
+#include "ParallelFor.h"
+#include "PersonManager.h"
+
+using namespace std;
+
+namespace {
+
+const size_t SHARD_COUNT = 64;
+const size_t CHUNK_SIZE = 1 << 16;  // Records hashed per task
+const size_t DETAIL_IDS = 10;       // Record IDs listed in one issue before "..."
+
+// One hashed key, pointing back at the record it came from
+struct KEYREF {
+    size_t hash;
+    string_view key;
+    size_t record;
+};
+
+using SHARDS = vector<vector<KEYREF>>;
+using ISSUELIST = vector<VALIDATIONISSUE>;
+using IDSET = unordered_set<string_view>;
+
+size_t shardOf(size_t hash) { return (hash >> 7) % SHARD_COUNT; }
+
+size_t chunkCount(size_t count) { return (count + CHUNK_SIZE - 1) / CHUNK_SIZE; }
+
+// FUNC: Hash the keys in parallel chunks; each chunk scatters into its own lists, then each shard is gathered
+SHARDS partitionKeys(size_t count, const function<string_view(size_t)> &keyAt, int &threads) {
+    size_t chunks = chunkCount(count);
+    vector<SHARDS> scattered(chunks, SHARDS(SHARD_COUNT));
+    threads = max(threads, parallelFor(chunks, [&](size_t chunk) {
+                      size_t end = min(count, (chunk + 1) * CHUNK_SIZE);
+                      for (size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+                          string_view key = keyAt(i);
+                          if (key.empty()) continue;
+                          size_t hash = std::hash<string_view>()(key);
+                          scattered[chunk][shardOf(hash)].push_back({hash, key, i});
+                      }
+                  }));
+
+    SHARDS shards(SHARD_COUNT);
+    parallelFor(SHARD_COUNT, [&](size_t shard) {
+        size_t total = 0;
+        for (const SHARDS &part : scattered) total += part[shard].size();
+        shards[shard].reserve(total);
+        for (const SHARDS &part : scattered) {
+            shards[shard].insert(shards[shard].end(), part[shard].begin(), part[shard].end());
+        }
+    });
+    return shards;
+}
+
+// FUNC: Sort one shard and call onGroup for every run of equal keys at least minSize long
+template <typename ONGROUP>
+void forEachGroup(vector<KEYREF> &shard, size_t minSize, ONGROUP onGroup) {
+    sort(shard.begin(), shard.end(), [](const KEYREF &a, const KEYREF &b) {
+        if (a.hash != b.hash) return a.hash < b.hash;
+        if (a.key != b.key) return a.key < b.key;
+        return a.record < b.record;
+    });
+
+    for (size_t start = 0; start < shard.size();) {
+        size_t end = start + 1;
+        while (end < shard.size() && shard[end].hash == shard[start].hash && shard[end].key == shard[start].key) {
+            ++end;
+        }
+        if (end - start >= minSize) {
+            onGroup(&shard[start], end - start);
+        }
+        start = end;
+    }
+}
+
+bool containsID(const vector<IDSET> &sets, const string &id) {
+    string_view key(id);
+    return sets[shardOf(std::hash<string_view>()(key))].count(key) != 0;
+}
+
+const PERSON &personAt(const vector<MEMBER> &members, const vector<HOST> &hosts, size_t record) {
+    if (record < members.size()) {
+        return members[record];
+    }
+    return hosts[record - members.size()];
+}
+
+// FUNC: People IDs - duplicates within a role, clashes across roles, and the ID sets trips are checked against
+void checkPersonIDs(const vector<MEMBER> &members, const vector<HOST> &hosts, vector<IDSET> &memberIDs,
+                    vector<IDSET> &hostIDs, vector<ISSUELIST> &found, int &threads) {
+    SHARDS shards = partitionKeys(
+        members.size() + hosts.size(),
+        [&](size_t i) { return string_view(personAt(members, hosts, i).getID()); }, threads);
+
+    parallelFor(SHARD_COUNT, [&](size_t shard) {
+        forEachGroup(shards[shard], 1, [&](const KEYREF *group, size_t size) {
+            size_t memberCount = 0;
+            for (size_t i = 0; i < size; ++i) {
+                if (group[i].record < members.size()) ++memberCount;
+            }
+            size_t hostCount = size - memberCount;
+            string id(group[0].key);
+
+            if (memberCount > 0) memberIDs[shard].insert(group[0].key);
+            if (hostCount > 0) hostIDs[shard].insert(group[0].key);
+            if (memberCount > 1) {
+                found[shard].push_back({VALIDATIONCHECK::DuplicateMemberID, id, to_string(memberCount) + " members"});
+            }
+            if (hostCount > 1) {
+                found[shard].push_back({VALIDATIONCHECK::DuplicateHostID, id, to_string(hostCount) + " hosts"});
+            }
+            if (memberCount > 0 && hostCount > 0) {
+                found[shard].push_back({VALIDATIONCHECK::CrossRoleID, id, "member and host"});
+            }
+        });
+    });
+}
+
+// FUNC: Emails or phones - every value held by more than one person, in normalized form
+void checkContacts(const vector<MEMBER> &members, const vector<HOST> &hosts, VALIDATIONCHECK check,
+                   vector<ISSUELIST> &found, int &threads) {
+    size_t count = members.size() + hosts.size();
+    vector<string> normalized(count);
+    threads = max(threads, parallelFor(chunkCount(count), [&](size_t chunk) {
+                      size_t end = min(count, (chunk + 1) * CHUNK_SIZE);
+                      for (size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+                          const PERSON &person = personAt(members, hosts, i);
+                          normalized[i] = (check == VALIDATIONCHECK::DuplicateEmail)
+                                              ? normalizeEmail(person.getEmail())
+                                              : normalizePhone(person.getPhoneNumber());
+                      }
+                  }));
+
+    SHARDS shards = partitionKeys(count, [&](size_t i) { return string_view(normalized[i]); }, threads);
+    parallelFor(SHARD_COUNT, [&](size_t shard) {
+        forEachGroup(shards[shard], 2, [&](const KEYREF *group, size_t size) {
+            string owners;
+            for (size_t i = 0; i < size && i < DETAIL_IDS; ++i) {
+                if (i > 0) owners += ", ";
+                owners += personAt(members, hosts, group[i].record).getID();
+            }
+            if (size > DETAIL_IDS) owners += ", ...";
+            found[shard].push_back({check, string(group[0].key), owners});
+        });
+    });
+}
+
+// FUNC: Trip IDs - the same trip twice, or different trips behind one ID
+void checkTripIDs(const TRIPSNAPSHOT &trips, vector<ISSUELIST> &found, int &threads) {
+    SHARDS shards = partitionKeys(trips.size(), [&](size_t i) { return string_view(trips[i].getID()); }, threads);
+    parallelFor(SHARD_COUNT, [&](size_t shard) {
+        forEachGroup(shards[shard], 2, [&](const KEYREF *group, size_t size) {
+            const TRIP &first = trips[group[0].record];
+            bool allSame = true;
+            for (size_t i = 1; i < size && allSame; ++i) {
+                allSame = isSameTrip(first, trips[group[i].record]);
+            }
+            if (allSame) {
+                found[shard].push_back({VALIDATIONCHECK::DuplicateTripID, first.getID(), to_string(size) + " copies"});
+            } else {
+                found[shard].push_back(
+                    {VALIDATIONCHECK::TripIDCollision, first.getID(), to_string(size) + " different trips"});
+            }
+        });
+    });
+}
+
+// FUNC: Per-trip checks - date order and references, looked up in the sharded ID sets
+void checkTripRecords(const TRIPSNAPSHOT &trips, const vector<IDSET> &memberIDs, const vector<IDSET> &hostIDs,
+                      vector<ISSUELIST> &found, int &threads) {
+    size_t chunks = chunkCount(trips.size());
+    found.resize(found.size() + chunks);
+    size_t firstList = found.size() - chunks;
+
+    threads = max(threads, parallelFor(chunks, [&](size_t chunk) {
+                      ISSUELIST &issues = found[firstList + chunk];
+                      size_t end = min(trips.size(), (chunk + 1) * CHUNK_SIZE);
+                      for (size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+                          const TRIP &trip = trips[i];
+                          if (trip.getEndDate() < trip.getStartDate()) {
+                              issues.push_back({VALIDATIONCHECK::EndBeforeStart, trip.getID(),
+                                                trip.getStartDate().toString() + " - " +
+                                                    trip.getEndDate().toString()});
+                          }
+                          if (trip.hasHost() && !containsID(hostIDs, trip.getHost().getID())) {
+                              issues.push_back({VALIDATIONCHECK::DanglingHost, trip.getID(), trip.getHost().getID()});
+                          }
+                          for (const MEMBER &member : trip.getMembers()) {
+                              if (!containsID(memberIDs, member.getID())) {
+                                  issues.push_back({VALIDATIONCHECK::DanglingMember, trip.getID(), member.getID()});
+                              }
+                          }
+                      }
+                  }));
+}
+
+}  // namespace
+
+const char *validationCheckName(VALIDATIONCHECK check) {
+    switch (check) {
+        case VALIDATIONCHECK::DuplicateMemberID:
+            return "Duplicate member IDs";
+        case VALIDATIONCHECK::DuplicateHostID:
+            return "Duplicate host IDs";
+        case VALIDATIONCHECK::CrossRoleID:
+            return "IDs used by a member and a host";
+        case VALIDATIONCHECK::DuplicateTripID:
+            return "Trips stored twice";
+        case VALIDATIONCHECK::TripIDCollision:
+            return "Trip ID collisions";
+        case VALIDATIONCHECK::DanglingHost:
+            return "Trips with an unknown host";
+        case VALIDATIONCHECK::DanglingMember:
+            return "Trips with an unknown member";
+        case VALIDATIONCHECK::EndBeforeStart:
+            return "Trips ending before they start";
+        case VALIDATIONCHECK::DuplicateEmail:
+            return "Shared emails";
+        case VALIDATIONCHECK::DuplicatePhone:
+            return "Shared phone numbers";
+        default:
+            return "Unknown check";
+    }
+}
+
+// ========================================
+// VALIDATIONREPORT
+// ========================================
+
+size_t VALIDATIONREPORT::totalIssues() const {
+    size_t total = 0;
+    for (size_t count : counts) total += count;
+    return total;
+}
+
+string VALIDATIONREPORT::summary() const {
+    string text = "Validated " + to_string(tripsChecked) + " trips and " + to_string(peopleChecked) + " people in " +
+                  to_string(elapsedMs) + " ms on " + to_string(threads) + " threads: " + to_string(totalIssues()) +
+                  " issues\n";
+    for (size_t check = 0; check < VALIDATION_CHECK_COUNT; ++check) {
+        if (counts[check] > 0) {
+            text += string("  ") + validationCheckName(static_cast<VALIDATIONCHECK>(check)) + ": " +
+                    to_string(counts[check]) + "\n";
+        }
+    }
+    for (const VALIDATIONISSUE &issue : issues) {
+        text += string("[") + validationCheckName(issue.check) + "] " + issue.recordID + ": " + issue.detail + "\n";
+    }
+    return text;
+}
+
+// ========================================
+// VALIDATION
+// ========================================
+
+VALIDATIONREPORT validateData(const TRIPSNAPSHOT &trips, const vector<MEMBER> &members, const vector<HOST> &hosts,
+                              size_t maxIssuesPerCheck) {
+    QElapsedTimer timer;
+    timer.start();
+
+    VALIDATIONREPORT report;
+    report.tripsChecked = trips.size();
+    report.peopleChecked = members.size() + hosts.size();
+
+    // Shard-owned lists first (one writer each), then the per-chunk lists of the trip pass
+    vector<ISSUELIST> found(SHARD_COUNT);
+    vector<IDSET> memberIDs(SHARD_COUNT);
+    vector<IDSET> hostIDs(SHARD_COUNT);
+
+    checkPersonIDs(members, hosts, memberIDs, hostIDs, found, report.threads);
+    checkContacts(members, hosts, VALIDATIONCHECK::DuplicateEmail, found, report.threads);
+    checkContacts(members, hosts, VALIDATIONCHECK::DuplicatePhone, found, report.threads);
+    checkTripIDs(trips, found, report.threads);
+    checkTripRecords(trips, memberIDs, hostIDs, found, report.threads);
+
+    vector<VALIDATIONISSUE> all;
+    for (ISSUELIST &issues : found) {
+        for (VALIDATIONISSUE &issue : issues) {
+            report.counts[static_cast<size_t>(issue.check)]++;
+            all.push_back(move(issue));
+        }
+    }
+
+    sort(all.begin(), all.end(), [](const VALIDATIONISSUE &a, const VALIDATIONISSUE &b) {
+        if (a.check != b.check) return a.check < b.check;
+        if (a.recordID != b.recordID) return a.recordID < b.recordID;
+        return a.detail < b.detail;
+    });
+
+    size_t kept[VALIDATION_CHECK_COUNT] = {};
+    for (VALIDATIONISSUE &issue : all) {
+        size_t &keptOfCheck = kept[static_cast<size_t>(issue.check)];
+        if (keptOfCheck < maxIssuesPerCheck) {
+            report.issues.push_back(move(issue));
+            ++keptOfCheck;
+        }
+    }
+
+    report.elapsedMs = timer.elapsed();
+    return report;
+}
+
+// FUNC: Validate the stores as they are on disk; attendees become ID-only placeholders
+VALIDATIONREPORT validateStoredData(STORAGEBACKEND backend, size_t maxIssuesPerCheck) {
+    vector<MEMBER> members;
+    vector<HOST> hosts;
+    createPersonStore(backend)->load(members, hosts);
+
+    vector<TRIP> trips;
+    vector<TRIPATTENDEEIDS> attendees;
+    createTripStore(backend)->load(trips, attendees);
+    for (size_t i = 0; i < trips.size() && i < attendees.size(); ++i) {
+        if (!attendees[i].hostID.empty()) {
+            trips[i].setHost(HOST(attendees[i].hostID, "", GENDER::Male, DATE()));
+        }
+        for (const string &memberID : attendees[i].memberIDs) {
+            trips[i].addMember(MEMBER(memberID, "", GENDER::Male, DATE()));
+        }
+    }
+
+    return validateData(TRIPCOLLECTION(move(trips)).snapshot(), members, hosts, maxIssuesPerCheck);
+}
@@ -0,0 +1,63 @@
+#ifndef DATAVALIDATOR_H
+#define DATAVALIDATOR_H
+
+#include <QtGlobal>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "DataStore.h"
+#include "TripCollection.h"
+
+using namespace std;
+
+enum class VALIDATIONCHECK {
+    DuplicateMemberID,  // Two members with one ID
+    DuplicateHostID,    // Two hosts with one ID
+    CrossRoleID,        // One ID used by a member and a host
+    DuplicateTripID,    // The same trip stored twice
+    TripIDCollision,    // Different trips sharing one ID
+    DanglingHost,       // A trip's host is not a known host
+    DanglingMember,     // A trip's member is not a known member
+    EndBeforeStart,     // A trip ends before it starts
+    DuplicateEmail,     // One email (normalized) used by several people
+    DuplicatePhone      // One phone number (digits only) used by several people
+};
+
+static const size_t VALIDATION_CHECK_COUNT = 10;
+static const size_t DEFAULT_ISSUES_PER_CHECK = 100;  // Issues kept per check; all are counted
+
+const char *validationCheckName(VALIDATIONCHECK check);
+
+struct VALIDATIONISSUE {
+    VALIDATIONCHECK check;
+    string recordID;  // The trip, person or shared value the issue is about
+    string detail;    // The clashing records or the missing reference
+};
+
+// Structured result of validateData
+struct VALIDATIONREPORT {
+    vector<VALIDATIONISSUE> issues;  // Ordered by check then record ID, capped per check
+    size_t counts[VALIDATION_CHECK_COUNT] = {};
+    size_t tripsChecked = 0;
+    size_t peopleChecked = 0;
+    int threads = 0;
+    qint64 elapsedMs = 0;
+
+    size_t count(VALIDATIONCHECK check) const { return counts[static_cast<size_t>(check)]; }
+    size_t totalIssues() const;
+    bool isClean() const { return totalIssues() == 0; }
+    string summary() const;  // One line per check that found something, then the kept issues
+};
+
+// Whole-dataset integrity check. Every check is hash based: keys are hashed and scattered into
+// shards in parallel chunks, then each shard is grouped on its own thread, so the work is O(n)
+// spread over the cores. Trip references are resolved against the sharded person ID sets.
+VALIDATIONREPORT validateData(const TRIPSNAPSHOT &trips, const vector<MEMBER> &members, const vector<HOST> &hosts,
+                              size_t maxIssuesPerCheck = DEFAULT_ISSUES_PER_CHECK);
+
+// Headless entry (--validate): loads the backend's stores directly, keeping trip attendees as the
+// IDs they were saved with, so references the startup loader would drop are reported too
+VALIDATIONREPORT validateStoredData(STORAGEBACKEND backend, size_t maxIssuesPerCheck = DEFAULT_ISSUES_PER_CHECK);
+
+#endif  // DATAVALIDATOR_H
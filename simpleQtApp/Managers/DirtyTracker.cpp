@@ -0,0 +1,107 @@
+#include "DirtyTracker.h"
+
+using namespace std;
+
+// CLASS: DIRTYTRACKER
+
+void DIRTYTRACKER::recordAdded(const string &id, quint64 recordHash) {
+    ++generation;
+    contentHash += recordHash;
+    removedIDs.erase(id);
+    upsertedIDs.insert(id);
+}
+
+void DIRTYTRACKER::recordRemoved(const string &id, quint64 recordHash) {
+    ++generation;
+    contentHash -= recordHash;
+    upsertedIDs.erase(id);
+    removedIDs.insert(id);
+}
+
+void DIRTYTRACKER::recordUpdated(const string &id, quint64 oldHash, quint64 newHash) {
+    ++generation;
+    contentHash += newHash - oldHash;
+    upsertedIDs.insert(id);
+}
+
+bool DIRTYTRACKER::isDirty() const { return generation != savedGeneration && contentHash != savedHash; }
+
+quint64 DIRTYTRACKER::getGeneration() const { return generation; }
+
+quint64 DIRTYTRACKER::getContentHash() const { return contentHash; }
+
+const unordered_set<string> &DIRTYTRACKER::getUpsertedIDs() const { return upsertedIDs; }
+
+const unordered_set<string> &DIRTYTRACKER::getRemovedIDs() const { return removedIDs; }
+
+void DIRTYTRACKER::markSaved() {
+    savedGeneration = generation;
+    savedHash = contentHash;
+    upsertedIDs.clear();
+    removedIDs.clear();
+}
+
+// FUNC: Record hashes
+namespace {
+
+struct FNV1A {
+    quint64 value = 1469598103934665603ULL;
+
+    void add(const void *data, size_t length) {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < length; ++i) {
+            value ^= bytes[i];
+            value *= 1099511628211ULL;
+        }
+    }
+    void add(const string &text) { add(text.data(), text.size() + 1); }  // Terminator separates fields
+    void add(int number) { add(&number, sizeof(number)); }
+    void add(double number) { add(&number, sizeof(number)); }
+};
+
+void addPerson(FNV1A &hash, const PERSON &person) {
+    hash.add(person.getID());
+    hash.add(person.getFullName());
+    hash.add(person.getEmail());
+    hash.add(person.getPhoneNumber());
+    hash.add(person.getAddress());
+    hash.add(static_cast<int>(person.getGender()));
+    hash.add(person.getDateOfBirth().toKey());
+}
+
+}  // namespace
+
+quint64 tripContentHash(const TRIP &trip) {
+    FNV1A hash;
+    hash.add(trip.getID());
+    hash.add(trip.getDestination());
+    hash.add(trip.getDescription());
+    hash.add(trip.getStartDate().toKey());
+    hash.add(trip.getEndDate().toKey());
+    hash.add(static_cast<int>(trip.getStatus()));
+    hash.add(trip.hasHost() ? trip.getHost().getID() : string());
+    for (const MEMBER &member : trip.getMembers()) {
+        hash.add(member.getID());
+    }
+    return hash.value;
+}
+
+quint64 memberContentHash(const MEMBER &member) {
+    FNV1A hash;
+    hash.add(string("M"));
+    addPerson(hash, member);
+    hash.add(member.getEmergencyContact());
+    for (const string &interest : member.getInterests()) {
+        hash.add(interest);
+    }
+    hash.add(member.getTotalSpent());
+    return hash.value;
+}
+
+quint64 hostContentHash(const HOST &host) {
+    FNV1A hash;
+    hash.add(string("H"));
+    addPerson(hash, host);
+    hash.add(host.getEmergencyContact());
+    return hash.value;
+}
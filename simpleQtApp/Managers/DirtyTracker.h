@@ -0,0 +1,46 @@
+#ifndef DIRTYTRACKER_H
+#define DIRTYTRACKER_H
+
+#include <QtGlobal>
+#include <string>
+#include <unordered_set>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+// CLASS: DIRTYTRACKER - what changed in one collection since it was last written
+// The generation counter makes the common "nothing happened" case a single comparison.
+// The content hash is the sum (mod 2^64) of per-record hashes, updated in O(1) per mutation, so
+// a change that is later undone also leaves the collection clean. Unlike an XOR, adding the same
+// record twice does not cancel out.
+// The upserted/removed ID sets are the dirty region handed to incremental backends.
+class DIRTYTRACKER {
+   private:
+    quint64 generation = 0;
+    quint64 savedGeneration = 0;
+    quint64 contentHash = 0;
+    quint64 savedHash = 0;
+    unordered_set<string> upsertedIDs;
+    unordered_set<string> removedIDs;
+
+   public:
+    void recordAdded(const string &id, quint64 recordHash);
+    void recordRemoved(const string &id, quint64 recordHash);
+    void recordUpdated(const string &id, quint64 oldHash, quint64 newHash);
+
+    bool isDirty() const;
+    quint64 getGeneration() const;
+    quint64 getContentHash() const;
+    const unordered_set<string> &getUpsertedIDs() const;
+    const unordered_set<string> &getRemovedIDs() const;
+
+    void markSaved();  // Current state now matches the store
+};
+
+// FUNC: Record hashes (FNV-1a over every persisted field)
+quint64 tripContentHash(const TRIP &trip);
+quint64 memberContentHash(const MEMBER &member);
+quint64 hostContentHash(const HOST &host);
+
+#endif  // DIRTYTRACKER_H
@@ -0,0 +1,95 @@
+#include "ExportJob.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+#include <exception>
+
+#include "CsvWriter.h"
+#include "Logger.h"
+
+using namespace std;
+
+// FUNC: Trips come as an O(1) snapshot; people by move, the UI thread never touches them again
+EXPORTJOB::EXPORTJOB(const TRIPSNAPSHOT &tripSnapshot, const string &filePath)
+    : trips(tripSnapshot), exportsTrips(true), filePath(filePath), cancelled(false) {}
+
+EXPORTJOB::EXPORTJOB(vector<MEMBER> &&memberSnapshot, vector<HOST> &&hostSnapshot, const string &filePath)
+    : exportsTrips(false),
+      members(make_shared<const vector<MEMBER>>(move(memberSnapshot))),
+      hosts(make_shared<const vector<HOST>>(move(hostSnapshot))),
+      filePath(filePath),
+      cancelled(false) {}
+
+void EXPORTJOB::cancel() { cancelled = true; }
+
+bool EXPORTJOB::isCancelled() const { return cancelled; }
+
+size_t EXPORTJOB::getTotalRows() const {
+    if (exportsTrips) {
+        return trips.size();
+    }
+    return (members ? members->size() : 0) + (hosts ? hosts->size() : 0);
+}
+
+const string &EXPORTJOB::getFilePath() const { return filePath; }
+
+const EXPORTRESULT &EXPORTJOB::getResult() const { return result; }
+
+// FUNC: Write every row, checking for cancellation between rows
+void EXPORTJOB::run(const ProgressCallback &onProgress) {
+    QElapsedTimer timer;
+    timer.start();
+
+    const size_t totalRows = getTotalRows();
+    const size_t reportEvery = max<size_t>(1, totalRows / 100);
+    size_t rowsDone = 0;
+
+    // Called after every row: reports progress and says whether to keep going
+    auto rowWritten = [&]() {
+        ++rowsDone;
+        if (rowsDone % reportEvery == 0 && onProgress) {
+            onProgress(rowsDone, totalRows);
+        }
+        return !cancelled;
+    };
+
+    try {
+        CSVWRITER writer(filePath, true);
+        bool keepGoing = true;
+
+        if (exportsTrips) {
+            writer.header(TRIP_CSV_HEADER);
+            for (auto it = trips.begin(); it != trips.end() && keepGoing; ++it) {
+                writeTripRow(writer, *it);
+                keepGoing = rowWritten();
+            }
+        } else {
+            writer.header(PEOPLE_CSV_HEADER);
+            for (auto it = members->begin(); it != members->end() && keepGoing; ++it) {
+                writeMemberRow(writer, *it);
+                keepGoing = rowWritten();
+            }
+            for (auto it = hosts->begin(); it != hosts->end() && keepGoing; ++it) {
+                writeHostRow(writer, *it);
+                keepGoing = rowWritten();
+            }
+        }
+
+        if (cancelled) {
+            writer.discard();
+            result.cancelled = true;
+        } else if (writer.close()) {
+            result.completed = true;
+        } else {
+            result.error = "Error writing file: " + filePath;
+        }
+        result.bytesWritten = writer.getBytesWritten();
+    } catch (const exception &e) {
+        result.error = e.what();
+    }
+
+    result.rowsWritten = rowsDone;
+    result.elapsedMs = timer.elapsed();
+    LOG_INFO("Export to", filePath, result.completed ? "completed:" : "stopped:", rowsDone, "of", totalRows,
+             "rows in", result.elapsedMs, "ms");
+}
@@ -0,0 +1,58 @@
+#ifndef EXPORTJOB_H
+#define EXPORTJOB_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "TripCollection.h"
+
+using namespace std;
+
+struct EXPORTRESULT {
+    bool completed = false;
+    bool cancelled = false;
+    string error;
+    size_t rowsWritten = 0;
+    quint64 bytesWritten = 0;
+    qint64 elapsedMs = 0;
+};
+
+// CLASS: EXPORTJOB - writes a CSV export on a worker thread
+// The job owns an immutable snapshot of the data taken on the UI thread (trips share their chunks
+// with TRIPMANAGER, people are copied), so the managers can keep changing while it runs. Rows go
+// to a temp file that only replaces the target once complete; a cancelled or failed export leaves
+// the previous file as it was.
+class EXPORTJOB {
+   public:
+    using ProgressCallback = function<void(size_t rowsDone, size_t totalRows)>;
+
+   private:
+    TRIPSNAPSHOT trips;
+    bool exportsTrips;
+    shared_ptr<const vector<MEMBER>> members;
+    shared_ptr<const vector<HOST>> hosts;
+    string filePath;
+    atomic<bool> cancelled;
+    EXPORTRESULT result;
+
+   public:
+    EXPORTJOB(const TRIPSNAPSHOT &tripSnapshot, const string &filePath);
+    EXPORTJOB(vector<MEMBER> &&memberSnapshot, vector<HOST> &&hostSnapshot, const string &filePath);
+
+    // Runs on the worker thread; progress is reported roughly every percent
+    void run(const ProgressCallback &onProgress);
+
+    void cancel();  // Safe from any thread
+    bool isCancelled() const;
+
+    size_t getTotalRows() const;
+    const string &getFilePath() const;
+    const EXPORTRESULT &getResult() const;  // Valid once run() has returned
+};
+
+#endif  // EXPORTJOB_H
@@ -1,7 +1,10 @@
 #include "FileManager.h"
 
 #include "../Models/header.h"
+#include "CsvWriter.h"
+#include "Logger.h"
 #include "PersonManager.h"
+#include "StreamingImport.h"
 
 // Helper function to get cache file path (relative to executable)
 QString getCacheFilePath() {
@@ -56,104 +59,50 @@ void createNewTrip(vector<TRIP> &Trips) {
     Trips.push_back(trip);
 }
 
-// FUNC: Import from CSV file
-void importTripInfo(vector<TRIP> &trips, const string &filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        qDebug() << "Error: Cannot open file for import:" << QString::fromStdString(filePath);
-        return;
-    }
+// FUNC: Parse one import row (Destination,Description,StartDate,EndDate,Status); the ID is generated
+bool parseTripImportLine(const string &line, TRIP &trip) {
+    // Quoted fields may contain commas and doubled quotes
+    std::vector<std::string> data;
+    splitCsvLine(line, data);
 
-    std::string line;
-    // Skip header line if it exists
-    if (std::getline(file, line) &&
-        (line.find("ID") != std::string::npos || line.find("Destination") != std::string::npos)) {
-        // This was a header line, continue reading
-        qDebug() << "Found header line:" << QString::fromStdString(line);
-    } else {
-        // This wasn't a header, reset file position to read from beginning
-        file.clear();
-        file.seekg(0);
+    if (data.size() < 5) {
+        return false;
     }
 
-    // For debugging
-    int lineCount = 0;
-    int successCount = 0;
-
-    while (std::getline(file, line)) {
-        lineCount++;
-        if (line.empty()) continue;
-
-        qDebug() << "Processing line" << lineCount << ":" << QString::fromStdString(line);
-
-        // Parse CSV line
-        std::vector<std::string> data;
-        std::stringstream ss(line);
-        std::string token;
-
-        // Better CSV parsing that handles quotes and commas within fields
-        bool inQuotes = false;
-        std::string field;
-
-        for (char c : line) {
-            if (c == '"') {
-                inQuotes = !inQuotes;
-            } else if (c == ',' && !inQuotes) {
-                data.push_back(field);
-                field.clear();
-            } else {
-                field += c;
-            }
+    try {
+        string destination = toUpper(data[0]);
+        DATE startDate = extractDate(data[2]);
+        DATE endDate = extractDate(data[3]);
+
+        // Unknown status strings fall back to Planned
+        STATUS status = STATUS::Planned;
+        if (data[4] == "Ongoing") {
+            status = STATUS::Ongoing;
+        } else if (data[4] == "Completed") {
+            status = STATUS::Completed;
+        } else if (data[4] == "Cancelled") {
+            status = STATUS::Cancelled;
         }
-        // Add the last field
-        data.push_back(field);
-
-        try {
-            // Check if we have enough data fields (adjust for no ID column)
-            if (data.size() >= 5) {  // CHANGED from 6 to 5
-                qDebug() << "Found" << data.size() << "fields in line" << lineCount;
-
-                // Extract data - ADJUST INDICES to match your CSV structure
-                string destination = toUpper(data[0]);  // Was data[1]
-                string description = data[1];           // Was data[2]
-                DATE startDate = extractDate(data[2]);  // Was data[3]
-                DATE endDate = extractDate(data[3]);    // Was data[4]
-
-                // Create status enum from string
-                STATUS status;
-                if (data[4] == "Planned") {  // Was data[5]
-                    status = STATUS::Planned;
-                } else if (data[4] == "Ongoing") {  // Added "Ongoing" option
-                    status = STATUS::Ongoing;
-                } else if (data[4] == "Completed") {
-                    status = STATUS::Completed;
-                } else if (data[4] == "Cancelled") {
-                    status = STATUS::Cancelled;
-                } else {
-                    status = STATUS::Planned;  // Default
-                }
-
-                // Generate ID based on destination and start date (keep this)
-                TRIP newTrip(TRIPFACTORY::generateTripID(destination, startDate), destination, description, startDate,
-                             endDate, status);
 
-                // Add to the trips vector
-                trips.push_back(newTrip);
-                successCount++;
-                qDebug() << "Successfully added trip:" << QString::fromStdString(destination)
-                         << "with generated ID:" << QString::fromStdString(newTrip.getID());
-            } else {
-                qDebug() << "Error: Not enough fields in line" << lineCount << ". Expected at least 5, got"
-                         << data.size();
-            }
-        } catch (const std::exception &e) {
-            qDebug() << "Error parsing trip data at line" << lineCount << ":" << QString::fromStdString(line) << " - "
-                     << QString::fromStdString(e.what());
-        }
+        // Generate ID based on destination and start date
+        trip = TRIP(TRIPFACTORY::generateTripID(destination, startDate), destination, data[1], startDate, endDate,
+                    status);
+        return true;
+    } catch (const std::exception &) {
+        return false;
     }
+}
 
-    file.close();
-    qDebug() << "Import complete. Processed" << lineCount << "lines, successfully imported" << successCount << "trips";
+// FUNC: Import from CSV file (collects the streaming import into one vector)
+void importTripInfo(vector<TRIP> &trips, const string &filePath) {
+    try {
+        TRIPCOLLECTORSINK collector(trips);
+        IMPORTSTATS stats = streamTripImport(filePath, collector);
+        LOG_INFO("Import complete. Processed", stats.rowsRead, "lines, successfully imported", stats.recordsParsed,
+                 "trips");
+    } catch (const exception &e) {
+        LOG_ERROR("Cannot open file for import:", e.what());
+    }
 }
 
 // FUNC: Print to console
@@ -164,80 +113,16 @@ void printTrip(vector<TRIP> Trips) {
 }
 
 // FUNC: Export to CSV file - UPDATED to include attendees
-void exportTripsInfo(vector<TRIP> Trips, const string outputFilePath) {
-    ofstream output(outputFilePath);
-    if (!output.is_open()) {
-        throw runtime_error("Cannot open file for writing: " + outputFilePath);
-    }
-
-    // Write header with attendees columns
-    output << "ID,Destination,Description,StartDate,EndDate,Status,HostID,MemberIDs\n";
-
+void exportTripsInfo(const vector<TRIP> &Trips, const string &outputFilePath) {
+    CSVWRITER writer(outputFilePath);  // Throws when the file cannot be opened
+    writer.header(TRIP_CSV_HEADER);
     for (const TRIP &trip : Trips) {
-        // Basic trip information
-        output << trip.getID() << "," << trip.getDestination() << "," << trip.getDescription() << ","
-               << trip.getStartDate().toString() << "," << trip.getEndDate().toString() << ","
-               << statusToString(trip.getStatus()) << ",";
-
-        // Host information
-        HOST host = trip.getHost();
-        if (!host.getID().empty()) {
-            output << host.getID();
-        }
-        output << ",";
-
-        // Members information (semicolon-separated list)
-        vector<MEMBER> members = trip.getMembers();
-        if (!members.empty()) {
-            for (size_t i = 0; i < members.size(); ++i) {
-                if (i > 0) output << ";";  // Separate multiple member IDs with semicolons
-                output << members[i].getID();
-            }
-        }
-        output << "\n";
+        writeTripRow(writer, trip);
     }
-
-    output.close();
-    qDebug() << "Exported" << Trips.size() << "trips with attendees to file";
-}
-
-// FUNC: Update cache file from current trips
-void updateCacheFile(const vector<TRIP> &Trips) {
-    QString cacheFilePath = getCacheFilePath();
-
-    try {
-        // exportTripsInfo(Trips, cacheFilePath.toStdString());
-        saveTripAttendeesToCache(Trips, cacheFilePath.toStdString());
-        qDebug() << "Cache file updated successfully:" << cacheFilePath;
-    } catch (const exception &e) {
-        qDebug() << "Error updating cache file:" << e.what();
-    }
-}
-
-// FUNC: Load trips info from cache file
-void loadCacheFile(vector<TRIP> &trips) {
-    QString cacheFilePath = getCacheFilePath();
-
-    QFileInfo cacheFile(cacheFilePath);
-    if (!cacheFile.exists()) {
-        qDebug() << "No cache file found at:" << cacheFilePath;
-        return;
-    }
-
-    try {
-        qDebug() << "Loading trips from cache:" << cacheFilePath;
-
-        // Clear existing trips before loading
-        trips.clear();
-
-        // Import from cache file
-        importTripFromCache(trips, cacheFilePath.toStdString());
-
-        qDebug() << "Successfully loaded" << trips.size() << "trips from cache";
-
-    } catch (const exception &e) {
-        qDebug() << "Error loading cache file:" << e.what();
+    if (!writer.close()) {
+        throw runtime_error("Error writing file: " + outputFilePath);
     }
+    LOG_INFO("Exported", Trips.size(), "trips with attendees to file");
 }
 
 // Helper function to get people cache file path (relative to executable)
@@ -254,201 +139,105 @@ bool peopleCacheFileExists() {
     return cacheFile.exists();
 }
 
-// FUNC: Import people from CSV file (updated for separate vectors)
-void importPeopleInfo(vector<MEMBER> &members, vector<HOST> &hosts, const string &filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        QMessageBox::critical(nullptr, "Error", "Cannot open file!");
-        return;
-    }
+// FUNC: Parse one people row (Name,DOB,Email,Phone,Gender,Address,Role[,...]) into members or hosts
+bool parsePersonLine(const string &csvLine, vector<MEMBER> &members, vector<HOST> &hosts) {
+    std::vector<std::string> data;
+    splitCsvLine(csvLine, data);
 
-    std::string line;
-    // Skip header line if it exists
-    if (std::getline(file, line) &&
-        (line.find("FullName") != std::string::npos || line.find("Name") != std::string::npos)) {
-        // This was a header line, continue reading
-    } else {
-        // This wasn't a header, reset file position
-        file.clear();
-        file.seekg(0);
+    // Minimum required fields: Name,DOB,Email,Phone,Gender,Address,Role
+    if (data.size() < 7) {
+        return false;
     }
 
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-
-        // Parse CSV line
-        size_t pos = 0;
-        std::vector<std::string> data;
-
-        while ((pos = line.find(',')) != std::string::npos) {
-            data.push_back(line.substr(0, pos));
-            line.erase(0, pos + 1);
-        }
-        data.push_back(line);  // Last element
-
-        try {
-            // Minimum required fields: Name,DOB,Email,Phone,Gender,Address,Role
-            if (data.size() >= 7) {
-                string fullName = data[0];
-                fullName = toUpper(fullName);
-                DATE dob = extractDate(data[1]);
-                string email = data[2];
-                string phone = data[3];
-                GENDER gender = stringToGender(data[4]);
-                string address = data[5];
-                string role = data[6];
-
-                // Create ID based on name and DOB
-                string personID = PERSONFACTORY::generatePersonID(fullName, dob);
-
-                if (role == "Member") {
-                    MEMBER member(personID, fullName, gender, dob);
-                    member.setEmail(email);
-                    member.setPhoneNumber(phone);
-                    member.setAddress(address);
-
-                    // Optional fields for Member
-                    if (data.size() > 7) member.setEmergencyContact(data[7]);
-
-                    // Parse interests if available (comma-separated in quotes)
-                    if (data.size() > 8) {
-                        string interestsStr = data[8];
-                        // Remove quotes if present
-                        if (interestsStr.front() == '"' && interestsStr.back() == '"') {
-                            interestsStr = interestsStr.substr(1, interestsStr.length() - 2);
-                        }
-
-                        stringstream ss(interestsStr);
-                        string interest;
-                        while (getline(ss, interest, ';')) {
-                            member.addInterest(interest);
-                        }
-                    }
+    try {
+        string fullName = toUpper(data[0]);
+        DATE dob = extractDate(data[1]);
+        string email = data[2];
+        string phone = data[3];
+        GENDER gender = stringToGender(data[4]);
+        string address = data[5];
+        string role = data[6];
+
+        // Create ID based on name and DOB
+        string personID = PERSONFACTORY::generatePersonID(fullName, dob);
+
+        if (role == "Member") {
+            MEMBER member(personID, fullName, gender, dob);
+            member.setEmail(email);
+            member.setPhoneNumber(phone);
+            member.setAddress(address);
+
+            // Optional fields for Member
+            if (data.size() > 7) member.setEmergencyContact(data[7]);
+
+            // Parse interests if available (semicolon-separated)
+            if (data.size() > 8) {
+                stringstream ss(data[8]);
+                string interest;
+                while (getline(ss, interest, ';')) {
+                    member.addInterest(interest);
+                }
+            }
 
-                    // Parse total spent if available
-                    if (data.size() > 9) {
-                        try {
-                            double totalSpent = stod(data[9]);
-                            totalSpent = (totalSpent < 0) ? totalSpent : 0.0;
-                            member.addToTotalSpent(totalSpent);
-                        } catch (...) {
-                            // Ignore conversion errors
-                        }
-                    }
+            // Parse total spent if available
+            if (data.size() > 9) {
+                try {
+                    double totalSpent = stod(data[9]);
+                    totalSpent = (totalSpent < 0) ? totalSpent : 0.0;
+                    member.addToTotalSpent(totalSpent);
+                } catch (...) {
+                    // Ignore conversion errors
+                }
+            }
 
-                    members.push_back(member);
-                } else if (role == "Host") {
-                    HOST host(personID, fullName, gender, dob);
-                    host.setEmail(email);
-                    host.setPhoneNumber(phone);
-                    host.setAddress(address);
+            members.push_back(member);
+            return true;
+        } else if (role == "Host") {
+            HOST host(personID, fullName, gender, dob);
+            host.setEmail(email);
+            host.setPhoneNumber(phone);
+            host.setAddress(address);
 
-                    // Optional fields for Host
-                    if (data.size() > 7) host.setEmergencyContact(data[7]);
+            // Optional fields for Host
+            if (data.size() > 7) host.setEmergencyContact(data[7]);
 
-                    hosts.push_back(host);
-                }
-            }
-        } catch (const std::exception &e) {
-            qDebug() << "Error parsing person data:" << QString::fromStdString(line) << " - "
-                     << QString::fromStdString(e.what());
+            hosts.push_back(host);
+            return true;
         }
+    } catch (const std::exception &e) {
+        LOG_WARNING("Error parsing person data:", csvLine, "-", e.what());
     }
+    return false;
+}
 
-    file.close();
-    qDebug() << "Imported" << members.size() << "members and" << hosts.size() << "hosts from file";
+// FUNC: Import people from CSV file (collects the streaming import into two vectors)
+void importPeopleInfo(vector<MEMBER> &members, vector<HOST> &hosts, const string &filePath) {
+    PEOPLECOLLECTORSINK collector(members, hosts);
+    streamPeopleImport(filePath, collector);  // Throws when the file cannot be opened
+    LOG_INFO("Imported", members.size(), "members and", hosts.size(), "hosts from file");
 }
 
 // FUNC: Export people to CSV file (updated for separate vectors)
 void exportPeopleInfo(const vector<MEMBER> &members, const vector<HOST> &hosts, const string &outputFilePath) {
-    std::ofstream output(outputFilePath);
-
-    if (!output.is_open()) {
-        QMessageBox::critical(nullptr, "Error", "Cannot open output file!");
-        return;
-    }
-
-    // Write CSV header
-    output << "FullName,DOB,Email,Phone,Gender,Address,Role,EmergencyContact";
-    // Additional Member-specific headers
-    output << ",Interests,TotalSpent\n";
-
-    // Write member data
+    CSVWRITER writer(outputFilePath);  // Throws when the file cannot be opened
+    writer.header(PEOPLE_CSV_HEADER);
     for (const MEMBER &member : members) {
-        output << member.getFullName() << "," << member.getDateOfBirth().toString() << "," << member.getEmail() << ","
-               << member.getPhoneNumber() << "," << genderToString(member.getGender()) << "," << member.getAddress()
-               << "," << member.getRole() << "," << member.getEmergencyContact() << ",";
-
-        // Interests - semicolon-separated within quotes
-        output << "\"";
-        const vector<string> &interests = member.getInterests();
-        for (size_t i = 0; i < interests.size(); i++) {
-            output << interests[i];
-            if (i < interests.size() - 1) {
-                output << ";";
-            }
-        }
-        output << "\",";
-
-        // Total spent
-        output << member.getTotalSpent() << "\n";
+        writeMemberRow(writer, member);
     }
-
-    // Write host data
     for (const HOST &host : hosts) {
-        output << host.getFullName() << "," << host.getDateOfBirth().toString() << "," << host.getEmail() << ","
-               << host.getPhoneNumber() << "," << genderToString(host.getGender()) << "," << host.getAddress() << ","
-               << host.getRole() << "," << host.getEmergencyContact()
-               << ",,\n";  // Empty fields for Member-specific columns
+        writeHostRow(writer, host);
     }
-
-    output.close();
-    qDebug() << "Exported" << members.size() << "members and" << hosts.size() << "hosts to file";
-}
-
-// FUNC: Load people from cache file (updated for separate vectors)
-void loadPeopleCacheFile(vector<MEMBER> &members, vector<HOST> &hosts) {
-    QString cacheFilePath = getPeopleCacheFilePath();
-
-    QFileInfo cacheFile(cacheFilePath);
-    if (!cacheFile.exists()) {
-        qDebug() << "No people cache file found at:" << cacheFilePath;
-        return;
-    }
-
-    try {
-        qDebug() << "Loading people from cache:" << cacheFilePath;
-
-        members.clear();
-        hosts.clear();
-
-        // Import from cache file
-        importPeopleInfo(members, hosts, cacheFilePath.toStdString());
-
-        qDebug() << "Successfully loaded" << members.size() << "members and" << hosts.size() << "hosts from cache";
-
-    } catch (const exception &e) {
-        qDebug() << "Error loading people cache file:" << e.what();
-    }
-}
-
-// FUNC: Update people cache file (updated for separate vectors)
-void updatePeopleCacheFile(const vector<MEMBER> &members, const vector<HOST> &hosts) {
-    QString cacheFilePath = getPeopleCacheFilePath();
-
-    try {
-        exportPeopleInfo(members, hosts, cacheFilePath.toStdString());
-        qDebug() << "People cache file updated successfully:" << cacheFilePath;
-    } catch (const exception &e) {
-        qDebug() << "Error updating people cache file:" << e.what();
+    if (!writer.close()) {
+        throw runtime_error("Error writing file: " + outputFilePath);
     }
+    LOG_INFO("Exported", members.size(), "members and", hosts.size(), "hosts to file");
 }
 
 // FUNC: Import trips from cache file (includes IDs and attendees) - UPDATED
 void importTripFromCache(vector<TRIP> &trips, const string &filePath) {
     std::ifstream file(filePath);
     if (!file.is_open()) {
-        qDebug() << "Error: Cannot open cache file for import:" << QString::fromStdString(filePath);
+        LOG_ERROR("Cannot open cache file for import:", filePath);
         return;
     }
 
@@ -456,7 +245,7 @@ void importTripFromCache(vector<TRIP> &trips, const string &filePath) {
     // Skip header line if it exists
     if (std::getline(file, line) &&
         (line.find("ID") != std::string::npos || line.find("Destination") != std::string::npos)) {
-        qDebug() << "Found header line:" << QString::fromStdString(line);
+        LOG_DEBUG("Found header line:", line);
     } else {
         file.clear();
         file.seekg(0);
@@ -469,31 +258,16 @@ void importTripFromCache(vector<TRIP> &trips, const string &filePath) {
         lineCount++;
         if (line.empty()) continue;
 
-        qDebug() << "Processing cache line" << lineCount << ":" << QString::fromStdString(line);
+        LOG_TRACE("Processing cache line", lineCount, ":", line);
 
         // Parse CSV line with better handling
         std::vector<std::string> data;
-        std::stringstream ss(line);
-        std::string token;
-        bool inQuotes = false;
-        std::string field;
-
-        for (char c : line) {
-            if (c == '"') {
-                inQuotes = !inQuotes;
-            } else if (c == ',' && !inQuotes) {
-                data.push_back(field);
-                field.clear();
-            } else {
-                field += c;
-            }
-        }
-        data.push_back(field);  // Add the last field
+        splitCsvLine(line, data);
 
         try {
             // Check if we have enough data fields (now expecting 8 fields with attendees)
             if (data.size() >= 6) {  // At minimum: ID,Destination,Description,StartDate,EndDate,Status
-                qDebug() << "Found" << data.size() << "fields in cache line" << lineCount;
+                LOG_TRACE("Found", data.size(), "fields in cache line", lineCount);
 
                 // Extract basic trip data
                 string id = data[0];
@@ -522,8 +296,7 @@ void importTripFromCache(vector<TRIP> &trips, const string &filePath) {
                 // Add host if available (data[6])
                 if (data.size() > 6 && !data[6].empty()) {
                     string hostID = data[6];
-                    qDebug() << "Trip" << QString::fromStdString(id)
-                             << "has host ID:" << QString::fromStdString(hostID);
+                    LOG_TRACE("Trip", id, "has host ID:", hostID);
 
                     // Note: We'll need to restore the actual HOST object from PersonManager
                     // For now, we store the ID and will restore the object later
@@ -533,15 +306,14 @@ void importTripFromCache(vector<TRIP> &trips, const string &filePath) {
                 // Add members if available (data[7])
                 if (data.size() > 7 && !data[7].empty()) {
                     string memberIDsString = data[7];
-                    qDebug() << "Trip" << QString::fromStdString(id)
-                             << "has member IDs:" << QString::fromStdString(memberIDsString);
+                    LOG_TRACE("Trip", id, "has member IDs:", memberIDsString);
 
                     // Parse semicolon-separated member IDs
                     std::stringstream memberStream(memberIDsString);
                     std::string memberID;
                     while (std::getline(memberStream, memberID, ';')) {
                         if (!memberID.empty()) {
-                            qDebug() << "  - Member ID:" << QString::fromStdString(memberID);
+                            LOG_TRACE("  - Member ID:", memberID);
                             // Note: We'll need to restore the actual MEMBER objects from PersonManager
                         }
                     }
@@ -549,34 +321,62 @@ void importTripFromCache(vector<TRIP> &trips, const string &filePath) {
 
                 trips.push_back(newTrip);
                 successCount++;
-                qDebug() << "Successfully loaded trip from cache:" << QString::fromStdString(id) << "-"
-                         << QString::fromStdString(destination);
+                LOG_TRACE("Successfully loaded trip from cache:", id, "-", destination);
 
             } else {
-                qDebug() << "Insufficient data fields in cache line" << lineCount << "- found" << data.size()
-                         << "fields";
+                LOG_WARNING("Insufficient data fields in cache line", lineCount, "- found", data.size(), "fields");
             }
 
         } catch (const exception &e) {
-            qDebug() << "Error parsing cache line" << lineCount << ":" << e.what();
+            LOG_WARNING("Error parsing cache line", lineCount, ":", e.what());
         }
     }
 
     file.close();
-    qDebug() << "Cache import completed. Processed" << lineCount << "lines, successfully loaded" << successCount
-             << "trips";
+    LOG_INFO("Cache import completed. Processed", lineCount, "lines, successfully loaded", successCount, "trips");
+}
+
+// FUNC: Parse one cache.csv row into a trip plus the attendee IDs that still need resolving
+bool parseTripCacheLine(const string &line, TRIP &trip, string &hostID, vector<string> &memberIDs) {
+    std::vector<std::string> data;
+    splitCsvLine(line, data);
+
+    // At minimum: ID,Destination,Description,StartDate,EndDate,Status
+    if (data.size() < 6) {
+        return false;
+    }
+
+    try {
+        trip = TRIP(data[0], data[1], data[2], extractDate(data[3]), extractDate(data[4]), stringToStatus(data[5]));
+    } catch (const exception &) {
+        return false;
+    }
+
+    hostID = (data.size() > 6) ? data[6] : "";
+
+    memberIDs.clear();
+    if (data.size() > 7 && !data[7].empty()) {
+        std::stringstream memberStream(data[7]);
+        std::string memberID;
+        while (std::getline(memberStream, memberID, ';')) {
+            if (!memberID.empty()) {
+                memberIDs.push_back(memberID);
+            }
+        }
+    }
+    return true;
 }
 
 // FUNC: Restore trip attendees from cache file - UPDATED for objects
 void restoreTripAttendeesFromCache(vector<TRIP> &trips, PERSONMANAGER *personManager, const string &filePath) {
     if (!personManager) {
-        qDebug() << "PersonManager is null, cannot restore trip attendees";
+        LOG_ERROR("PersonManager is null, cannot restore trip attendees");
         return;
     }
 
     std::ifstream file(filePath);
     if (!file.is_open()) {
-        qDebug() << "Error: Cannot open cache file for attendee restoration:" << QString::fromStdString(filePath);
+        LOG_ERROR("Cannot open cache file for attendee restoration:", filePath);
         return;
     }
 
@@ -593,22 +393,7 @@ void restoreTripAttendeesFromCache(vector<TRIP> &trips, PERSONMANAGER *personMan
 
         // Parse CSV line
         std::vector<std::string> data;
-        std::stringstream ss(line);
-        std::string token;
-        bool inQuotes = false;
-        std::string field;
-
-        for (char c : line) {
-            if (c == '"') {
-                inQuotes = !inQuotes;
-            } else if (c == ',' && !inQuotes) {
-                data.push_back(field);
-                field.clear();
-            } else {
-                field += c;
-            }
-        }
-        data.push_back(field);
+        splitCsvLine(line, data);
 
         if (data.size() >= 6) {
             string tripID = data[0];
@@ -622,11 +407,9 @@ void restoreTripAttendeesFromCache(vector<TRIP> &trips, PERSONMANAGER *personMan
                         HOST host = personManager->getHostByID(hostID);  // FIX: Get object, not pointer
                         if (!host.getID().empty()) {                     // FIX: Check if host is valid (has ID)
                             trip.setHost(host);
-                            qDebug() << "Restored host" << QString::fromStdString(hostID) << "to trip"
-                                     << QString::fromStdString(tripID);
+                            LOG_TRACE("Restored host", hostID, "to trip", tripID);
                         } else {
-                            qDebug() << "Warning: Host with ID" << QString::fromStdString(hostID)
-                                     << "not found in PersonManager";
+                            LOG_WARNING("Host with ID", hostID, "not found in PersonManager");
                         }
                     }
 
@@ -641,11 +424,9 @@ void restoreTripAttendeesFromCache(vector<TRIP> &trips, PERSONMANAGER *personMan
                                 MEMBER member = personManager->getMemberByID(memberID);  // FIX: Get object, not pointer
                                 if (!member.getID().empty()) {  // FIX: Check if member is valid (has ID)
                                     trip.addMember(member);
-                                    qDebug() << "Restored member" << QString::fromStdString(memberID) << "to trip"
-                                             << QString::fromStdString(tripID);
+                                    LOG_TRACE("Restored member", memberID, "to trip", tripID);
                                 } else {
-                                    qDebug() << "Warning: Member with ID" << QString::fromStdString(memberID)
-                                             << "not found in PersonManager";
+                                    LOG_WARNING("Member with ID", memberID, "not found in PersonManager");
                                 }
                             }
                         }
@@ -657,60 +438,18 @@ void restoreTripAttendeesFromCache(vector<TRIP> &trips, PERSONMANAGER *personMan
     }
 
     file.close();
-    qDebug() << "Trip attendees restoration completed";
+    LOG_INFO("Trip attendees restoration completed");
 }
 
 // FUNC: Save trip attendees to cache file - NEW
 void saveTripAttendeesToCache(const vector<TRIP> &trips, const string &filePath) {
-    std::ofstream output(filePath);
-    if (!output.is_open()) {
-        qDebug() << "Error: Cannot open cache file for writing:" << QString::fromStdString(filePath);
-        return;
-    }
-
-    // Write header with attendees columns
-    output << "ID,Destination,Description,StartDate,EndDate,Status,HostID,MemberIDs\n";
-
-    int savedCount = 0;
+    CSVWRITER writer(filePath);  // Throws when the file cannot be opened
+    writer.header(TRIP_CSV_HEADER);
     for (const TRIP &trip : trips) {
-        try {
-            // Basic trip information
-            output << trip.getID() << "," << trip.getDestination() << "," << trip.getDescription() << ","
-                   << trip.getStartDate().toString() << "," << trip.getEndDate().toString() << ","
-                   << statusToString(trip.getStatus()) << ",";
-
-            // Host information
-            HOST host = trip.getHost();
-            if (!host.getID().empty()) {
-                output << host.getID();
-                qDebug() << "Saving host" << QString::fromStdString(host.getID()) << "for trip"
-                         << QString::fromStdString(trip.getID());
-            }
-            output << ",";
-
-            // Members information (semicolon-separated list)
-            vector<MEMBER> members = trip.getMembers();
-            if (!members.empty()) {
-                qDebug() << "Saving" << members.size() << "members for trip" << QString::fromStdString(trip.getID());
-
-                for (size_t i = 0; i < members.size(); ++i) {
-                    if (i > 0) output << ";";  // Separate multiple member IDs with semicolons
-                    output << members[i].getID();
-
-                    qDebug() << "  - Member:" << QString::fromStdString(members[i].getID());
-                }
-            }
-            output << "\n";
-
-            savedCount++;
-
-        } catch (const std::exception &e) {
-            qDebug() << "Error saving trip" << QString::fromStdString(trip.getID())
-                     << "to cache:" << QString::fromStdString(e.what());
-        }
+        writeTripRow(writer, trip);
     }
-
-    output.close();
-    qDebug() << "Successfully saved" << savedCount
-             << "trips with attendees to cache file:" << QString::fromStdString(filePath);
-}
\ No newline at end of file
+    if (!writer.close()) {
+        throw runtime_error("Error writing cache file: " + filePath);
+    }
+    LOG_INFO("Successfully saved", trips.size(), "trips with attendees to cache file:", filePath);
+}
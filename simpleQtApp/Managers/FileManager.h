@@ -5,7 +5,6 @@
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
-#include <QMessageBox>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -25,21 +24,22 @@ using namespace std;
 void createNewTrip(vector<TRIP> &Trips);
 void printTrip(vector<TRIP> Trips);
 void importTripInfo(vector<TRIP> &trips, const string &filepath);
-void exportTripsInfo(vector<TRIP> Trips, const string outputFilePath);
-void loadCacheFile(vector<TRIP> &trips);
-void updateCacheFile(const vector<TRIP> &Trips);
+void exportTripsInfo(const vector<TRIP> &Trips, const string &outputFilePath);
 bool cacheFileExists();
 QString getCacheFilePath();
 
+// Throws runtime_error when the file cannot be opened; the caller decides how to tell the user
 void importPeopleInfo(vector<MEMBER> &members, vector<HOST> &hosts, const string &filePath);
 void importTripFromCache(vector<TRIP> &trips, const string &filePath);
 void exportPeopleInfo(const vector<MEMBER> &members, const vector<HOST> &hosts, const string &outputFilePath);
-void loadPeopleCacheFile(vector<MEMBER> &members, vector<HOST> &hosts);
-void updatePeopleCacheFile(const vector<MEMBER> &members, const vector<HOST> &hosts);
 bool peopleCacheFileExists();
 QString getPeopleCacheFilePath();
 
+bool parseTripImportLine(const string &line, TRIP &trip);
+bool parsePersonLine(const string &csvLine, vector<MEMBER> &members, vector<HOST> &hosts);
+bool parseTripCacheLine(const string &line, TRIP &trip, string &hostID, vector<string> &memberIDs);
 void restoreTripAttendeesFromCache(vector<TRIP> &trips, PERSONMANAGER *personManager, const string &filePath);
+// Throws runtime_error when the cache cannot be written
 void saveTripAttendeesToCache(const vector<TRIP> &trips, const string &filePath);
 
 // #endif  // TRIPMANAGER_H
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "HostAvailability.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "BookingConflicts.h"
+
+using namespace std;
+
+// FUNC: Collect each host's bookings, sort them by start and take the running maximum end
+void HOSTAVAILABILITY::rebuild(const TRIPMANAGER &tripManager, const string &ignoreTripID) {
+    unordered_map<string, vector<pair<int, int>>> bookings;
+    for (const TRIP &trip : tripManager.getAllTrips()) {
+        if (!trip.hasHost() || !blocksBooking(trip) || trip.getID() == ignoreTripID) continue;
+        bookings[trip.getHost().getID()].emplace_back(trip.getStartDate().toKey(), trip.getEndDate().toKey());
+    }
+
+    calendars.clear();
+    calendars.reserve(bookings.size());
+    for (auto &host : bookings) {
+        vector<pair<int, int>> &intervals = host.second;
+        sort(intervals.begin(), intervals.end());
+
+        CALENDAR &calendar = calendars[host.first];
+        calendar.startKeys.reserve(intervals.size());
+        calendar.maxEndKeys.reserve(intervals.size());
+        int latestEnd = 0;
+        for (const auto &interval : intervals) {
+            latestEnd = max(latestEnd, interval.second);
+            calendar.startKeys.push_back(interval.first);
+            calendar.maxEndKeys.push_back(latestEnd);
+        }
+    }
+}
+
+bool HOSTAVAILABILITY::isFree(const string &hostID, const DATE &start, const DATE &end) const {
+    auto it = calendars.find(hostID);
+    if (it == calendars.end()) {
+        return true;
+    }
+
+    const CALENDAR &calendar = it->second;
+    auto pastEnd = upper_bound(calendar.startKeys.begin(), calendar.startKeys.end(), end.toKey());
+    if (pastEnd == calendar.startKeys.begin()) {
+        return true;  // Every trip starts after the range
+    }
+    size_t lastStarted = static_cast<size_t>(pastEnd - calendar.startKeys.begin()) - 1;
+    return calendar.maxEndKeys[lastStarted] < start.toKey();
+}
@@ -0,0 +1,32 @@
+#ifndef HOSTAVAILABILITY_H
+#define HOSTAVAILABILITY_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Models/header.h"
+#include "TripManager.h"
+
+using namespace std;
+
+// CLASS: HOSTAVAILABILITY - answers "which hosts are free between A and B" for the trip pickers
+// Each host's trips are kept sorted by start date next to the running maximum of their end dates.
+// A host is busy over [A, B] when a trip starting on or before B ends on or after A, so one binary
+// search for the last start <= B and one look at the prefix maximum decide it: O(log k) per host.
+class HOSTAVAILABILITY {
+   private:
+    struct CALENDAR {
+        vector<int> startKeys;   // Sorted
+        vector<int> maxEndKeys;  // maxEndKeys[i] = latest end among the first i + 1 trips
+    };
+    unordered_map<string, CALENDAR> calendars;
+
+   public:
+    // Snapshot of the booked dates; ignoreTripID is the trip being edited, which never blocks itself
+    void rebuild(const TRIPMANAGER &tripManager, const string &ignoreTripID = "");
+
+    bool isFree(const string &hostID, const DATE &start, const DATE &end) const;
+};
+
+#endif  // HOSTAVAILABILITY_H
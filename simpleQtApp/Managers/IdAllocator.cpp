@@ -0,0 +1,78 @@
+#include "IdAllocator.h"
+
+#include <cctype>
+
+using namespace std;
+
+namespace {
+
+void appendTwoDigits(string &text, int value) {
+    text += static_cast<char>('0' + (value / 10) % 10);
+    text += static_cast<char>('0' + value % 10);
+}
+
+void appendNumber(string &text, unsigned value) {
+    char digits[12];
+    int count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (count > 0) {
+        text += digits[--count];
+    }
+}
+
+}  // namespace
+
+string formatBaseID(const string &words, const DATE &date) {
+    string id;
+    id.reserve(16);
+    bool isNewWord = true;
+    for (char c : words) {
+        if (isspace(static_cast<unsigned char>(c))) {
+            isNewWord = true;
+        } else if (isNewWord) {
+            id += static_cast<char>(toupper(static_cast<unsigned char>(c)));
+            isNewWord = false;
+        }
+    }
+
+    id += '_';
+    appendTwoDigits(id, date.getMonth());
+    appendTwoDigits(id, date.getDay());
+    return id;
+}
+
+bool isSameTrip(const TRIP &a, const TRIP &b) {
+    return a.getDestination() == b.getDestination() && a.getStartDate().toKey() == b.getStartDate().toKey() &&
+           a.getEndDate().toKey() == b.getEndDate().toKey();
+}
+
+bool isSamePerson(const PERSON &a, const PERSON &b) {
+    return a.getFullName() == b.getFullName() && a.getDateOfBirth().toKey() == b.getDateOfBirth().toKey();
+}
+
+// CLASS: IDALLOCATOR
+
+IDALLOCATOR::IDALLOCATOR(IDCHECK isTaken) : isTaken(move(isTaken)) {}
+
+bool IDALLOCATOR::isAvailable(const string &id) const { return reserved.count(id) == 0 && !isTaken(id); }
+
+// FUNC: Probe base, base-2, base-3, ... - each probe is two hash lookups
+string IDALLOCATOR::allocate(const string &baseID, const IDCHECK &isSameRecord) {
+    string candidate = baseID;
+    for (unsigned suffix = 2;; ++suffix) {
+        if (isAvailable(candidate)) {
+            reserved.insert(candidate);
+            return candidate;
+        }
+        if (isSameRecord && isSameRecord(candidate)) {
+            return string();
+        }
+
+        candidate.assign(baseID);
+        candidate += '-';
+        appendNumber(candidate, suffix);
+    }
+}
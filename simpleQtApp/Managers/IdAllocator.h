@@ -0,0 +1,41 @@
+#ifndef IDALLOCATOR_H
+#define IDALLOCATOR_H
+
+#include <functional>
+#include <string>
+#include <unordered_set>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+// Base ID shared by trips and people: the initial of every word, upper-cased, then "_MMDD".
+// Formatted straight into one string; different years of the same day give the same base.
+string formatBaseID(const string &words, const DATE &date);
+
+// Natural keys used to tell a re-imported record from a different one with the same base ID
+bool isSameTrip(const TRIP &a, const TRIP &b);      // Destination, start and end date
+bool isSamePerson(const PERSON &a, const PERSON &b);  // Full name and full date of birth
+
+// CLASS: IDALLOCATOR - turns a base ID into one nobody holds yet
+// isTaken is the owner's live ID set (an O(1) index lookup). A clash is resolved with the first
+// free suffix: base, base-2, base-3, ... so the result only depends on which IDs are taken.
+// Handed-out IDs stay reserved for the allocator's lifetime, which keeps a bulk import unique
+// before its records reach the manager.
+class IDALLOCATOR {
+   public:
+    using IDCHECK = function<bool(const string &id)>;
+
+   private:
+    IDCHECK isTaken;
+    unordered_set<string> reserved;
+
+   public:
+    explicit IDALLOCATOR(IDCHECK isTaken);
+
+    // Returns "" when isSameRecord finds this very record under one of the candidate IDs
+    string allocate(const string &baseID, const IDCHECK &isSameRecord = nullptr);
+    bool isAvailable(const string &id) const;
+};
+
+#endif  // IDALLOCATOR_H
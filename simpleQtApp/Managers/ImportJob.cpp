@@ -0,0 +1,184 @@
+#include "ImportJob.h"
+
+#include <QFileInfo>
+#include <QString>
+#include <exception>
+
+#include "Logger.h"
+#include "PersonManager.h"
+#include "TripManager.h"
+
+using namespace std;
+
+namespace {
+
+// Forwards parsed batches to the job's callbacks; consume() blocks while the UI is behind
+class TRIPFORWARDSINK : public TRIPSINK {
+   private:
+    const function<bool()> &waitForRoom;
+    const IMPORTJOB::TripBatchCallback &onTrips;
+    const function<void(const IMPORTSTATS &)> &onProgress;
+
+   public:
+    TRIPFORWARDSINK(const function<bool()> &wait, const IMPORTJOB::TripBatchCallback &trips,
+                    const function<void(const IMPORTSTATS &)> &progressed)
+        : waitForRoom(wait), onTrips(trips), onProgress(progressed) {}
+
+    bool consume(vector<TRIP> &&batch) override {
+        if (!waitForRoom()) return false;
+        onTrips(move(batch));
+        return true;
+    }
+    void progress(const IMPORTSTATS &soFar) override { onProgress(soFar); }
+};
+
+class PEOPLEFORWARDSINK : public PERSONSINK {
+   private:
+    const function<bool()> &waitForRoom;
+    const IMPORTJOB::PeopleBatchCallback &onPeople;
+    const function<void(const IMPORTSTATS &)> &onProgress;
+
+   public:
+    PEOPLEFORWARDSINK(const function<bool()> &wait, const IMPORTJOB::PeopleBatchCallback &people,
+                      const function<void(const IMPORTSTATS &)> &progressed)
+        : waitForRoom(wait), onPeople(people), onProgress(progressed) {}
+
+    bool consume(vector<MEMBER> &&members, vector<HOST> &&hosts) override {
+        if (!waitForRoom()) return false;
+        onPeople(move(members), move(hosts));
+        return true;
+    }
+    void progress(const IMPORTSTATS &soFar) override { onProgress(soFar); }
+};
+
+}  // namespace
+
+// ========================================
+// IMPORTJOB
+// ========================================
+
+IMPORTJOB::IMPORTJOB(IMPORTKIND kind, const string &filePath, size_t batchSize, size_t maxBatchesInFlight)
+    : kind(kind),
+      filePath(filePath),
+      batchSize(batchSize),
+      maxBatchesInFlight(max<size_t>(1, maxBatchesInFlight)),
+      fileSize(static_cast<quint64>(QFileInfo(QString::fromStdString(filePath)).size())),
+      cancelled(false),
+      batchesInFlight(0) {}
+
+// FUNC: Block the parser until the UI has room for another batch; claims the slot
+bool IMPORTJOB::waitForRoom() {
+    unique_lock<mutex> guard(lock);
+    roomAvailable.wait(guard, [this]() { return cancelled || batchesInFlight < maxBatchesInFlight; });
+    if (cancelled) {
+        return false;
+    }
+    ++batchesInFlight;
+    return true;
+}
+
+void IMPORTJOB::run(const TripBatchCallback &onTrips, const PeopleBatchCallback &onPeople,
+                    const ProgressCallback &onProgress) {
+    function<bool()> wait = [this]() { return waitForRoom(); };
+    function<void(const IMPORTSTATS &)> progressed = [&](const IMPORTSTATS &soFar) {
+        {
+            lock_guard<mutex> guard(lock);
+            stats = soFar;
+        }
+        if (onProgress) onProgress(soFar, fileSize);
+    };
+
+    IMPORTSTATS finalStats;
+    try {
+        if (kind == IMPORTKIND::Trips) {
+            TRIPFORWARDSINK sink(wait, onTrips, progressed);
+            finalStats = streamTripImport(filePath, sink, batchSize);
+        } else {
+            PEOPLEFORWARDSINK sink(wait, onPeople, progressed);
+            finalStats = streamPeopleImport(filePath, sink, batchSize);
+        }
+    } catch (const exception &e) {
+        lock_guard<mutex> guard(lock);
+        error = e.what();
+        LOG_ERROR("Import of", filePath, "failed:", error);
+        return;
+    }
+
+    lock_guard<mutex> guard(lock);
+    stats = finalStats;
+    LOG_INFO("Import of", filePath, cancelled ? "cancelled after" : "parsed", finalStats.recordsParsed, "records in",
+             finalStats.batches, "batches");
+}
+
+void IMPORTJOB::batchApplied() {
+    {
+        lock_guard<mutex> guard(lock);
+        if (batchesInFlight > 0) --batchesInFlight;
+    }
+    roomAvailable.notify_one();
+}
+
+void IMPORTJOB::cancel() {
+    {
+        lock_guard<mutex> guard(lock);
+        cancelled = true;
+    }
+    roomAvailable.notify_all();
+}
+
+bool IMPORTJOB::isCancelled() const { return cancelled; }
+
+IMPORTKIND IMPORTJOB::getKind() const { return kind; }
+
+const string &IMPORTJOB::getFilePath() const { return filePath; }
+
+quint64 IMPORTJOB::getFileSize() const { return fileSize; }
+
+IMPORTSTATS IMPORTJOB::getStats() const {
+    lock_guard<mutex> guard(lock);
+    return stats;
+}
+
+string IMPORTJOB::getError() const {
+    lock_guard<mutex> guard(lock);
+    return error;
+}
+
+// ========================================
+// IMPORTTRANSACTION
+// ========================================
+
+IMPORTTRANSACTION::IMPORTTRANSACTION(TRIPMANAGER &tripManager, PERSONMANAGER &personManager)
+    : tripManager(tripManager), personManager(personManager), duplicates(0), rejected(0), contactConflicts(0) {}
+
+void IMPORTTRANSACTION::applyTrips(vector<TRIP> &&batch) {
+    TRIPIMPORTRESULT result = tripManager.importTrips(move(batch));
+    duplicates += result.duplicateIDs.size();
+    rejected += result.rejectedIDs.size();
+    for (const string &tripID : result.rejectedIDs) {
+        LOG_WARNING("Import rejected trip", tripID, "(strict integrity mode)");
+    }
+    addedTripIDs.insert(addedTripIDs.end(), result.addedIDs.begin(), result.addedIDs.end());
+}
+
+void IMPORTTRANSACTION::applyPeople(vector<MEMBER> &&members, vector<HOST> &&hosts) {
+    PEOPLEIMPORTRESULT result = personManager.importPeople(move(members), move(hosts));
+    duplicates += result.duplicateIDs.size();
+    contactConflicts += result.contactConflictIDs.size();
+    addedPersonIDs.insert(addedPersonIDs.end(), result.addedIDs.begin(), result.addedIDs.end());
+}
+
+void IMPORTTRANSACTION::rollback() {
+    size_t removed = tripManager.removeTrips(addedTripIDs) + personManager.removePeople(addedPersonIDs);
+    LOG_INFO("Import rolled back,", removed, "records removed");
+    addedTripIDs.clear();
+    addedPersonIDs.clear();
+}
+
+size_t IMPORTTRANSACTION::getAddedCount() const { return addedTripIDs.size() + addedPersonIDs.size(); }
+
+size_t IMPORTTRANSACTION::getDuplicateCount() const { return duplicates; }
+
+size_t IMPORTTRANSACTION::getRejectedCount() const { return rejected; }
+
+size_t IMPORTTRANSACTION::getContactConflictCount() const { return contactConflicts; }
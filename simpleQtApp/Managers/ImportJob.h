@@ -0,0 +1,93 @@
+#ifndef IMPORTJOB_H
+#define IMPORTJOB_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "StreamingImport.h"
+
+using namespace std;
+
+class TRIPMANAGER;
+class PERSONMANAGER;
+
+enum class IMPORTKIND { Trips, People };
+
+// CLASS: IMPORTJOB - parses an import file on a worker thread
+// Parsed batches are handed to the callbacks, which post them to the UI thread; the UI calls
+// batchApplied() once a batch is in the managers. At most maxBatchesInFlight batches wait in the
+// event loop at a time, so a large file never piles up in memory ahead of the UI.
+class IMPORTJOB {
+   public:
+    using TripBatchCallback = function<void(vector<TRIP> &&batch)>;
+    using PeopleBatchCallback = function<void(vector<MEMBER> &&members, vector<HOST> &&hosts)>;
+    using ProgressCallback = function<void(const IMPORTSTATS &soFar, quint64 fileSize)>;
+
+   private:
+    IMPORTKIND kind;
+    string filePath;
+    size_t batchSize;
+    size_t maxBatchesInFlight;
+    quint64 fileSize;
+    atomic<bool> cancelled;
+
+    mutable mutex lock;
+    condition_variable roomAvailable;
+    size_t batchesInFlight;
+    IMPORTSTATS stats;
+    string error;
+
+    bool waitForRoom();  // false once cancelled
+
+   public:
+    IMPORTJOB(IMPORTKIND kind, const string &filePath, size_t batchSize = DEFAULT_IMPORT_BATCH,
+              size_t maxBatchesInFlight = 4);
+
+    // Runs on the worker thread; only the callback matching the kind is used
+    void run(const TripBatchCallback &onTrips, const PeopleBatchCallback &onPeople, const ProgressCallback &onProgress);
+
+    void batchApplied();  // UI thread, once per batch handed out
+    void cancel();        // Safe from any thread
+    bool isCancelled() const;
+
+    IMPORTKIND getKind() const;
+    const string &getFilePath() const;
+    quint64 getFileSize() const;
+    IMPORTSTATS getStats() const;  // Final once run() has returned
+    string getError() const;
+};
+
+// CLASS: IMPORTTRANSACTION - applies import batches on the UI thread and can undo them
+// Records whose ID is already known (in the managers or earlier in the same file) are counted as
+// duplicates and left out, so a rollback only ever removes what this import added. Trips the
+// integrity guard turns down in strict mode are counted as rejected.
+class IMPORTTRANSACTION {
+   private:
+    TRIPMANAGER &tripManager;
+    PERSONMANAGER &personManager;
+    vector<string> addedTripIDs;
+    vector<string> addedPersonIDs;
+    size_t duplicates;
+    size_t rejected;
+    size_t contactConflicts;
+
+   public:
+    IMPORTTRANSACTION(TRIPMANAGER &tripManager, PERSONMANAGER &personManager);
+
+    void applyTrips(vector<TRIP> &&batch);
+    void applyPeople(vector<MEMBER> &&members, vector<HOST> &&hosts);
+    void rollback();  // Removes everything applied so far, one bulk call per manager
+
+    size_t getAddedCount() const;
+    size_t getDuplicateCount() const;
+    size_t getRejectedCount() const;  // Failed an integrity check in strict mode
+    size_t getContactConflictCount() const;  // People added although their email or phone was taken
+};
+
+#endif  // IMPORTJOB_H
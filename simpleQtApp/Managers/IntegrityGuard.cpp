@@ -0,0 +1,141 @@
+#include "IntegrityGuard.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "Logger.h"
+
+using namespace std;
+
+namespace {
+
+const size_t LOGGED_ISSUES = 10;  // Issues logged one per line for a mutation; the rest are counted
+
+atomic<int> modeSelection(-1);  // -1 = not decided yet, read the environment
+
+}  // namespace
+
+// ========================================
+// MODE SELECTION
+// ========================================
+
+bool parseIntegrityMode(const QString &name, INTEGRITYMODE &mode) {
+    QString key = name.trimmed().toLower();
+    if (key == "off") {
+        mode = INTEGRITYMODE::Off;
+    } else if (key == "warn") {
+        mode = INTEGRITYMODE::Warn;
+    } else if (key == "strict") {
+        mode = INTEGRITYMODE::Strict;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+QString integrityModeName(INTEGRITYMODE mode) {
+    switch (mode) {
+        case INTEGRITYMODE::Off:
+            return "off";
+        case INTEGRITYMODE::Strict:
+            return "strict";
+        default:
+            return "warn";
+    }
+}
+
+INTEGRITYMODE selectedIntegrityMode() {
+    if (modeSelection < 0) {
+        INTEGRITYMODE mode = INTEGRITYMODE::Warn;
+        QString fromEnvironment = QString::fromUtf8(qgetenv("TRIP_INTEGRITY"));
+        if (!fromEnvironment.isEmpty() && !parseIntegrityMode(fromEnvironment, mode)) {
+            LOG_WARNING("Unknown TRIP_INTEGRITY value", fromEnvironment, "- warning only");
+        }
+        modeSelection = static_cast<int>(mode);
+    }
+    return static_cast<INTEGRITYMODE>(modeSelection.load());
+}
+
+void selectIntegrityMode(INTEGRITYMODE mode) { modeSelection = static_cast<int>(mode); }
+
+// ========================================
+// INTEGRITYGUARD
+// ========================================
+
+INTEGRITYGUARD::INTEGRITYGUARD() : mode(selectedIntegrityMode()), lastIssueCount(0), lastRejectedCount(0) {}
+
+void INTEGRITYGUARD::setMode(INTEGRITYMODE newMode) { mode = newMode; }
+
+INTEGRITYMODE INTEGRITYGUARD::getMode() const { return mode; }
+
+bool INTEGRITYGUARD::isEnabled() const { return mode != INTEGRITYMODE::Off; }
+
+void INTEGRITYGUARD::begin() {
+    lastIssues.clear();
+    lastIssueCount = 0;
+    lastRejectedCount = 0;
+}
+
+void INTEGRITYGUARD::record(vector<VALIDATIONISSUE> &&issues) {
+    lastIssueCount += issues.size();
+    for (VALIDATIONISSUE &issue : issues) {
+        if (lastIssues.size() >= DEFAULT_ISSUES_PER_CHECK) break;
+        lastIssues.push_back(move(issue));
+    }
+}
+
+bool INTEGRITYGUARD::admit(vector<VALIDATIONISSUE> &&issues, bool mayReject) {
+    if (issues.empty()) {
+        return true;
+    }
+
+    record(move(issues));
+    if (mayReject && mode == INTEGRITYMODE::Strict) {
+        ++lastRejectedCount;
+        return false;
+    }
+    return true;
+}
+
+bool INTEGRITYGUARD::refuse(vector<VALIDATIONISSUE> &&issues) {
+    record(move(issues));
+    ++lastRejectedCount;
+    return false;
+}
+
+void INTEGRITYGUARD::end(const char *operation) {
+    if (lastIssueCount == 0) {
+        return;
+    }
+
+    size_t logged = min(lastIssues.size(), LOGGED_ISSUES);
+    for (size_t i = 0; i < logged; ++i) {
+        const VALIDATIONISSUE &issue = lastIssues[i];
+        LOG_WARNING(operation, "-", validationCheckName(issue.check), issue.recordID, issue.detail);
+    }
+    if (lastIssueCount > logged) {
+        LOG_WARNING(operation, "- and", lastIssueCount - logged, "more integrity issues");
+    }
+    if (lastRejectedCount > 0) {
+        LOG_WARNING(operation, "rejected", lastRejectedCount, "records");
+    }
+}
+
+const vector<VALIDATIONISSUE> &INTEGRITYGUARD::getLastIssues() const { return lastIssues; }
+
+size_t INTEGRITYGUARD::getLastIssueCount() const { return lastIssueCount; }
+
+size_t INTEGRITYGUARD::getLastRejectedCount() const { return lastRejectedCount; }
+
+string INTEGRITYGUARD::describeLastIssues(size_t maxLines) const {
+    string text;
+    size_t shown = min(lastIssues.size(), maxLines);
+    for (size_t i = 0; i < shown; ++i) {
+        const VALIDATIONISSUE &issue = lastIssues[i];
+        text += string(validationCheckName(issue.check)) + ": " + issue.recordID + " (" + issue.detail + ")\n";
+    }
+    if (lastIssueCount > shown) {
+        text += "... and " + to_string(lastIssueCount - shown) + " more\n";
+    }
+    return text;
+}
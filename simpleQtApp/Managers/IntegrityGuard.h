@@ -0,0 +1,57 @@
+#ifndef INTEGRITYGUARD_H
+#define INTEGRITYGUARD_H
+
+#include <QString>
+#include <string>
+#include <vector>
+
+#include "DataValidator.h"
+
+using namespace std;
+
+// What the managers do when a mutation would break an invariant
+enum class INTEGRITYMODE {
+    Off,    // No per-mutation checks
+    Warn,   // Log the issue and apply the change anyway
+    Strict  // Reject the change; the manager's return value says so
+};
+
+bool parseIntegrityMode(const QString &name, INTEGRITYMODE &mode);
+QString integrityModeName(INTEGRITYMODE mode);
+INTEGRITYMODE selectedIntegrityMode();  // --integrity=... or TRIP_INTEGRITY, Warn otherwise
+void selectIntegrityMode(INTEGRITYMODE mode);
+
+// CLASS: INTEGRITYGUARD - decides on the issues a manager found for one mutation or batch
+// The managers only check the keys a mutation touches against their live indexes (ID lookups are
+// O(1) hash probes), so the batch validator never has to run again after an edit. Issues use the
+// validator's vocabulary; the last mutation's findings stay readable for the UI.
+class INTEGRITYGUARD {
+   private:
+    INTEGRITYMODE mode;
+    vector<VALIDATIONISSUE> lastIssues;  // First DEFAULT_ISSUES_PER_CHECK of the last mutation's issues
+    size_t lastIssueCount;
+    size_t lastRejectedCount;
+
+    void record(vector<VALIDATIONISSUE> &&issues);
+
+   public:
+    INTEGRITYGUARD();  // Starts in selectedIntegrityMode()
+
+    void setMode(INTEGRITYMODE newMode);
+    INTEGRITYMODE getMode() const;
+    bool isEnabled() const;
+
+    void begin();  // Starts a mutation or batch, forgetting what the previous one found
+    // Records one record's issues; false when the record must not be applied. Bulk restores pass
+    // mayReject = false so stored data is reported, never dropped.
+    bool admit(vector<VALIDATIONISSUE> &&issues, bool mayReject = true);
+    bool refuse(vector<VALIDATIONISSUE> &&issues);  // Rejects in every mode (e.g. an ID already taken)
+    void end(const char *operation);  // Logs the findings: a few lines, then a count
+
+    const vector<VALIDATIONISSUE> &getLastIssues() const;
+    size_t getLastIssueCount() const;
+    size_t getLastRejectedCount() const;
+    string describeLastIssues(size_t maxLines = 10) const;  // For message boxes
+};
+
+#endif  // INTEGRITYGUARD_H
@@ -0,0 +1,201 @@
+#include "LazyTripStore.h"
+
+#include <cstring>
+
+#include "FileManager.h"
+#include "Logger.h"
+#include "PersonManager.h"
+
+using namespace std;
+
+// FUNC: Constructor / Destructor
+LAZYTRIPSTORE::LAZYTRIPSTORE(size_t cacheCapacity)
+    : data(nullptr),
+      dataSize(0),
+      rowCount(0),
+      personManager(nullptr),
+      cacheCapacity(max<size_t>(1, cacheCapacity)),
+      hits(0),
+      misses(0) {}
+
+LAZYTRIPSTORE::~LAZYTRIPSTORE() { close(); }
+
+// FUNC: Map the file and index every OFFSET_STRIDE-th line start
+bool LAZYTRIPSTORE::open(const QString &filePath) {
+    close();
+
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        LOG_ERROR("LazyTripStore: cannot open", filePath);
+        return false;
+    }
+
+    dataSize = file.size();
+    if (dataSize == 0) {
+        return true;
+    }
+
+    uchar *mapped = file.map(0, dataSize);
+    if (!mapped) {
+        LOG_ERROR("LazyTripStore: cannot map", filePath);
+        file.close();
+        return false;
+    }
+    data = reinterpret_cast<const char *>(mapped);
+
+    const char *cursor = data;
+    const char *end = data + dataSize;
+
+    // Skip the header line if present
+    const char *firstNewline = static_cast<const char *>(memchr(cursor, '\n', end - cursor));
+    const char *firstLineEnd = firstNewline ? firstNewline : end;
+    string firstLine(cursor, firstLineEnd - cursor);
+    if (firstLine.find("ID") != string::npos || firstLine.find("Destination") != string::npos) {
+        cursor = firstNewline ? firstNewline + 1 : end;
+    }
+
+    while (cursor < end) {
+        const char *newline = static_cast<const char *>(memchr(cursor, '\n', end - cursor));
+        const char *lineEnd = newline ? newline : end;
+
+        // Blank lines do not count as rows
+        if (lineEnd > cursor && !(lineEnd - cursor == 1 && *cursor == '\r')) {
+            if (rowCount % OFFSET_STRIDE == 0) {
+                sparseOffsets.push_back(cursor - data);
+            }
+            ++rowCount;
+        }
+        cursor = newline ? newline + 1 : end;
+    }
+
+    LOG_INFO("LazyTripStore: indexed", rowCount, "trips using", getIndexBytes(), "bytes");
+    return true;
+}
+
+void LAZYTRIPSTORE::close() {
+    if (data) {
+        file.unmap(reinterpret_cast<uchar *>(const_cast<char *>(data)));
+        data = nullptr;
+    }
+    if (file.isOpen()) {
+        file.close();
+    }
+    dataSize = 0;
+    rowCount = 0;
+    sparseOffsets.clear();
+    sparseOffsets.shrink_to_fit();
+    recency.clear();
+    hydrated.clear();
+    hits = 0;
+    misses = 0;
+}
+
+bool LAZYTRIPSTORE::isOpen() const { return file.isOpen(); }
+
+void LAZYTRIPSTORE::setPersonManager(PERSONMANAGER *manager) {
+    personManager = manager;
+    recency.clear();
+    hydrated.clear();  // Cached trips were resolved against the previous manager
+}
+
+void LAZYTRIPSTORE::setCacheCapacity(size_t capacity) {
+    cacheCapacity = max<size_t>(1, capacity);
+    while (hydrated.size() > cacheCapacity) {
+        hydrated.erase(recency.back());
+        recency.pop_back();
+    }
+}
+
+size_t LAZYTRIPSTORE::size() const { return rowCount; }
+
+// FUNC: Nearest indexed row, then walk forward at most OFFSET_STRIDE - 1 lines
+qint64 LAZYTRIPSTORE::rowOffset(size_t row) const {
+    qint64 offset = sparseOffsets[row / OFFSET_STRIDE];
+    size_t remaining = row % OFFSET_STRIDE;
+    const char *end = data + dataSize;
+
+    while (remaining > 0) {
+        const char *newline = static_cast<const char *>(memchr(data + offset, '\n', end - (data + offset)));
+        if (!newline) {
+            break;
+        }
+        offset = newline + 1 - data;
+
+        // Skip blank lines exactly like open() did
+        const char *lineEnd = static_cast<const char *>(memchr(data + offset, '\n', end - (data + offset)));
+        qint64 length = (lineEnd ? lineEnd : end) - (data + offset);
+        if (length > 0 && !(length == 1 && data[offset] == '\r')) {
+            --remaining;
+        }
+    }
+    return offset;
+}
+
+// FUNC: Parse one row into a TRIP, resolving attendees when a PERSONMANAGER is attached
+shared_ptr<const TRIP> LAZYTRIPSTORE::hydrate(size_t row) const {
+    qint64 offset = rowOffset(row);
+    const char *start = data + offset;
+    const char *end = data + dataSize;
+    const char *newline = static_cast<const char *>(memchr(start, '\n', end - start));
+    string line(start, (newline ? newline : end) - start);
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+
+    auto trip = make_shared<TRIP>();
+    string hostID;
+    vector<string> memberIDs;
+    if (!parseTripCacheLine(line, *trip, hostID, memberIDs)) {
+        return trip;
+    }
+
+    if (personManager) {
+        if (!hostID.empty()) {
+            HOST host = personManager->getHostByID(hostID);
+            if (!host.getID().empty()) {
+                trip->setHost(host);
+            }
+        }
+        for (const string &memberID : memberIDs) {
+            MEMBER member = personManager->getMemberByID(memberID);
+            if (!member.getID().empty()) {
+                trip->addMember(member);
+            }
+        }
+    }
+    return trip;
+}
+
+// FUNC: LRU lookup, hydrating on a miss
+shared_ptr<const TRIP> LAZYTRIPSTORE::tripAt(size_t row) {
+    if (row >= rowCount) {
+        return nullptr;
+    }
+
+    auto it = hydrated.find(row);
+    if (it != hydrated.end()) {
+        ++hits;
+        recency.splice(recency.begin(), recency, it->second.position);
+        return it->second.trip;
+    }
+
+    ++misses;
+    shared_ptr<const TRIP> trip = hydrate(row);
+
+    if (hydrated.size() >= cacheCapacity) {
+        hydrated.erase(recency.back());
+        recency.pop_back();
+    }
+    recency.push_front(row);
+    hydrated.emplace(row, CACHEDTRIP{trip, recency.begin()});
+    return trip;
+}
+
+// FUNC: Diagnostics
+size_t LAZYTRIPSTORE::getHydratedCount() const { return hydrated.size(); }
+
+size_t LAZYTRIPSTORE::getIndexBytes() const { return sparseOffsets.capacity() * sizeof(qint64); }
+
+size_t LAZYTRIPSTORE::getCacheHits() const { return hits; }
+
+size_t LAZYTRIPSTORE::getCacheMisses() const { return misses; }
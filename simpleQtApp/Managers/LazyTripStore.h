@@ -0,0 +1,71 @@
+#ifndef LAZYTRIPSTORE_H
+#define LAZYTRIPSTORE_H
+
+#include <QFile>
+#include <QString>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+class PERSONMANAGER;
+
+// CLASS: LAZYTRIPSTORE - read-mostly view over a memory-mapped trip cache/archive
+// Only a sparse offset index (one entry per OFFSET_STRIDE rows) is built at open time.
+// TRIP objects are parsed on first access and kept in a bounded LRU, so resident
+// memory stays flat no matter how large the archive is; the OS pages the mapping.
+class LAZYTRIPSTORE {
+   public:
+    static const size_t OFFSET_STRIDE = 32;
+
+   private:
+    QFile file;
+    const char *data;
+    qint64 dataSize;
+    size_t rowCount;
+    vector<qint64> sparseOffsets;  // Byte offset of rows 0, STRIDE, 2*STRIDE, ...
+
+    PERSONMANAGER *personManager;  // Optional, resolves host/member IDs on hydration
+
+    // LRU of hydrated trips: most recently used at the front
+    size_t cacheCapacity;
+    list<size_t> recency;
+    struct CACHEDTRIP {
+        shared_ptr<const TRIP> trip;
+        list<size_t>::iterator position;
+    };
+    unordered_map<size_t, CACHEDTRIP> hydrated;
+
+    size_t hits;
+    size_t misses;
+
+    qint64 rowOffset(size_t row) const;
+    shared_ptr<const TRIP> hydrate(size_t row) const;
+
+   public:
+    explicit LAZYTRIPSTORE(size_t cacheCapacity = 1024);
+    ~LAZYTRIPSTORE();
+
+    bool open(const QString &filePath);
+    void close();
+    bool isOpen() const;
+
+    void setPersonManager(PERSONMANAGER *manager);
+    void setCacheCapacity(size_t capacity);
+
+    size_t size() const;
+    shared_ptr<const TRIP> tripAt(size_t row);
+
+    // FUNC: Diagnostics
+    size_t getHydratedCount() const;
+    size_t getIndexBytes() const;
+    size_t getCacheHits() const;
+    size_t getCacheMisses() const;
+};
+
+#endif  // LAZYTRIPSTORE_H
@@ -0,0 +1,247 @@
+#include "Logger.h"
+
+#include <QByteArray>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "log ring size must be a power of two");
+
+// Timestamps are relative to the first use of the logger
+qint64 elapsedSinceStart() {
+    static QElapsedTimer clock;
+    static once_flag started;
+    call_once(started, []() { clock.start(); });
+    return clock.elapsed();
+}
+
+int initialLevel() {
+    LOGLEVEL level = LOGLEVEL::Info;
+    QString fromEnvironment = QString::fromUtf8(qgetenv("TRIP_LOG_LEVEL"));
+    if (!fromEnvironment.isEmpty()) {
+        parseLogLevel(fromEnvironment, level);
+    }
+    return static_cast<int>(level);
+}
+
+void defaultSink(LOGLEVEL level, qint64 msecsSinceStart, const char *text, size_t length) {
+    QString line = QString("[%1 %2] %3")
+                       .arg(msecsSinceStart / 1000.0, 0, 'f', 3)
+                       .arg(logLevelName(level))
+                       .arg(QString::fromUtf8(text, static_cast<int>(length)));
+    if (level >= LOGLEVEL::Warning) {
+        qWarning().noquote() << line;
+    } else {
+        qDebug().noquote() << line;
+    }
+}
+
+}  // namespace
+
+// ========================================
+// LOGLINE
+// ========================================
+
+void LOGLINE::appendRaw(const char *data, size_t size) {
+    size_t room = LOG_MESSAGE_SIZE - length;
+    if (size > room) size = room;
+    memcpy(text + length, data, size);
+    length += size;
+}
+
+void LOGLINE::appendUnsigned(unsigned long long value) {
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    char ordered[20];
+    for (size_t i = 0; i < count; ++i) ordered[i] = digits[count - 1 - i];
+    appendRaw(ordered, count);
+}
+
+void LOGLINE::appendSigned(long long value) {
+    if (value < 0) {
+        appendRaw("-", 1);
+        appendUnsigned(0ULL - static_cast<unsigned long long>(value));
+    } else {
+        appendUnsigned(static_cast<unsigned long long>(value));
+    }
+}
+
+void LOGLINE::separate() { appendRaw(" ", 1); }
+
+void LOGLINE::append(const char *value) {
+    if (value) appendRaw(value, strlen(value));
+}
+
+void LOGLINE::append(const string &value) { appendRaw(value.data(), value.size()); }
+
+void LOGLINE::append(const QString &value) {
+    QByteArray utf8 = value.toUtf8();
+    appendRaw(utf8.constData(), static_cast<size_t>(utf8.size()));
+}
+
+void LOGLINE::append(char value) { appendRaw(&value, 1); }
+
+void LOGLINE::append(bool value) { value ? appendRaw("true", 4) : appendRaw("false", 5); }
+
+void LOGLINE::append(double value) {
+    char buffer[32];
+    int written = snprintf(buffer, sizeof(buffer), "%g", value);
+    if (written > 0) appendRaw(buffer, min(static_cast<size_t>(written), sizeof(buffer) - 1));
+}
+
+// ========================================
+// LOGGER
+// ========================================
+
+atomic<int> LOGGER::runtimeLevel(initialLevel());
+
+LOGGER::LOGGER()
+    : ring(new SLOT[LOG_RING_SIZE]), enqueuePos(0), dequeuePos(0), dropped(0), running(true), sink(defaultSink) {
+    for (size_t i = 0; i < LOG_RING_SIZE; ++i) {
+        ring[i].sequence.store(i, memory_order_relaxed);
+    }
+    elapsedSinceStart();
+    drainer = thread(&LOGGER::drainLoop, this);
+}
+
+LOGGER::~LOGGER() {
+    running = false;
+    if (drainer.joinable()) {
+        drainer.join();
+    }
+    flush();
+}
+
+LOGGER &LOGGER::instance() {
+    static LOGGER logger;
+    return logger;
+}
+
+void LOGGER::setLevel(LOGLEVEL level) { runtimeLevel.store(static_cast<int>(level), memory_order_relaxed); }
+
+LOGLEVEL LOGGER::getLevel() { return static_cast<LOGLEVEL>(runtimeLevel.load(memory_order_relaxed)); }
+
+// FUNC: Claim a slot with a CAS on the enqueue position; the slot's sequence publishes it
+bool LOGGER::push(LOGLEVEL level, const LOGLINE &line) {
+    size_t pos = enqueuePos.load(memory_order_relaxed);
+    SLOT *slot = nullptr;
+    for (;;) {
+        slot = &ring[pos & (LOG_RING_SIZE - 1)];
+        size_t sequence = slot->sequence.load(memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            dropped.fetch_add(1, memory_order_relaxed);  // Full: the drainer is behind
+            return false;
+        } else {
+            pos = enqueuePos.load(memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->timestamp = elapsedSinceStart();
+    slot->length = line.size();
+    memcpy(slot->text, line.data(), line.size());
+    slot->sequence.store(pos + 1, memory_order_release);
+    return true;
+}
+
+// FUNC: Hand every published slot to the sink, in order
+size_t LOGGER::drain() {
+    lock_guard<mutex> consumer(drainLock);
+    lock_guard<mutex> guard(sinkLock);
+    size_t count = 0;
+    for (;;) {
+        SLOT &slot = ring[dequeuePos & (LOG_RING_SIZE - 1)];
+        if (slot.sequence.load(memory_order_acquire) != dequeuePos + 1) {
+            break;
+        }
+        if (sink) {
+            sink(slot.level, slot.timestamp, slot.text, slot.length);
+        }
+        slot.sequence.store(dequeuePos + LOG_RING_SIZE, memory_order_release);
+        ++dequeuePos;
+        ++count;
+    }
+    return count;
+}
+
+void LOGGER::drainLoop() {
+    size_t reportedDrops = 0;
+    while (running) {
+        if (drain() == 0) {
+            this_thread::sleep_for(chrono::milliseconds(20));
+        }
+
+        size_t drops = dropped.load(memory_order_relaxed);
+        if (drops != reportedDrops) {
+            LOGLINE line;
+            line.append(drops - reportedDrops);
+            line.append(" log lines dropped, the ring buffer was full");
+            push(LOGLEVEL::Warning, line);
+            reportedDrops = drops;
+        }
+    }
+}
+
+void LOGGER::setSink(LOGSINK newSink) {
+    lock_guard<mutex> guard(sinkLock);
+    sink = move(newSink);
+}
+
+void LOGGER::flush() { drain(); }
+
+size_t LOGGER::getDroppedCount() const { return dropped.load(memory_order_relaxed); }
+
+bool parseLogLevel(const QString &name, LOGLEVEL &level) {
+    QString key = name.trimmed().toLower();
+    if (key == "trace") {
+        level = LOGLEVEL::Trace;
+    } else if (key == "debug") {
+        level = LOGLEVEL::Debug;
+    } else if (key == "info") {
+        level = LOGLEVEL::Info;
+    } else if (key == "warning") {
+        level = LOGLEVEL::Warning;
+    } else if (key == "error") {
+        level = LOGLEVEL::Error;
+    } else if (key == "off") {
+        level = LOGLEVEL::Off;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char *logLevelName(LOGLEVEL level) {
+    switch (level) {
+        case LOGLEVEL::Trace:
+            return "TRACE";
+        case LOGLEVEL::Debug:
+            return "DEBUG";
+        case LOGLEVEL::Info:
+            return "INFO";
+        case LOGLEVEL::Warning:
+            return "WARN";
+        case LOGLEVEL::Error:
+            return "ERROR";
+        default:
+            return "OFF";
+    }
+}
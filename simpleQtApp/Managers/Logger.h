@@ -0,0 +1,151 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+using namespace std;
+
+enum class LOGLEVEL : int { Trace = 0, Debug = 1, Info = 2, Warning = 3, Error = 4, Off = 5 };
+
+// Calls below this level are compiled out, arguments and all.
+// Release builds keep Info and up; define LOG_COMPILED_LEVEL to override.
+#ifndef LOG_COMPILED_LEVEL
+#ifdef QT_NO_DEBUG
+#define LOG_COMPILED_LEVEL 2
+#else
+#define LOG_COMPILED_LEVEL 0
+#endif
+#endif
+
+// Arguments are only evaluated once both the compiled and the runtime level let the call through
+#define TRIP_LOG(level, ...)                                                                    \
+    do {                                                                                        \
+        if (static_cast<int>(level) >= LOG_COMPILED_LEVEL && LOGGER::isEnabled(level)) {        \
+            LOGGER::write(level, __VA_ARGS__);                                                  \
+        }                                                                                       \
+    } while (0)
+
+#define LOG_TRACE(...) TRIP_LOG(LOGLEVEL::Trace, __VA_ARGS__)
+#define LOG_DEBUG(...) TRIP_LOG(LOGLEVEL::Debug, __VA_ARGS__)
+#define LOG_INFO(...) TRIP_LOG(LOGLEVEL::Info, __VA_ARGS__)
+#define LOG_WARNING(...) TRIP_LOG(LOGLEVEL::Warning, __VA_ARGS__)
+#define LOG_ERROR(...) TRIP_LOG(LOGLEVEL::Error, __VA_ARGS__)
+
+static const size_t LOG_MESSAGE_SIZE = 240;  // Longer messages are truncated
+static const size_t LOG_RING_SIZE = 4096;    // Slots, must be a power of two
+
+// CLASS: LOGLINE - fixed-size message built on the caller's stack
+// Values are formatted straight into the buffer, separated by spaces like qDebug.
+class LOGLINE {
+   private:
+    char text[LOG_MESSAGE_SIZE];
+    size_t length = 0;
+
+    void appendRaw(const char *data, size_t size);
+    void appendSigned(long long value);
+    void appendUnsigned(unsigned long long value);
+
+   public:
+    void separate();
+
+    void append(const char *value);
+    void append(const string &value);
+    void append(const QString &value);
+    void append(char value);
+    void append(bool value);
+    void append(double value);
+
+    template <typename T>
+    typename enable_if<is_integral<T>::value && !is_same<T, bool>::value && !is_same<T, char>::value>::type append(
+        T value) {
+        if (is_signed<T>::value) {
+            appendSigned(static_cast<long long>(value));
+        } else {
+            appendUnsigned(static_cast<unsigned long long>(value));
+        }
+    }
+
+    const char *data() const { return text; }
+    size_t size() const { return length; }
+};
+
+// Receives drained lines on the logger's background thread
+using LOGSINK = function<void(LOGLEVEL level, qint64 msecsSinceStart, const char *text, size_t length)>;
+
+// CLASS: LOGGER - lock-free ring buffer of log lines, drained by a background thread
+// Producers never block: when the ring is full the line is dropped and counted.
+class LOGGER {
+   private:
+    struct SLOT {
+        atomic<size_t> sequence;
+        LOGLEVEL level;
+        qint64 timestamp;
+        size_t length;
+        char text[LOG_MESSAGE_SIZE];
+    };
+
+    static atomic<int> runtimeLevel;
+
+    unique_ptr<SLOT[]> ring;
+    atomic<size_t> enqueuePos;
+    size_t dequeuePos;
+    atomic<size_t> dropped;
+    atomic<bool> running;
+    mutex drainLock;  // One consumer at a time (background thread or flush)
+    mutex sinkLock;
+    LOGSINK sink;
+    thread drainer;
+
+    LOGGER();
+    ~LOGGER();
+
+    bool push(LOGLEVEL level, const LOGLINE &line);
+    size_t drain();
+    void drainLoop();
+
+    template <typename T>
+    static void appendAll(LOGLINE &line, const T &value) {
+        line.append(value);
+    }
+    template <typename T, typename... Rest>
+    static void appendAll(LOGLINE &line, const T &value, const Rest &...rest) {
+        line.append(value);
+        line.separate();
+        appendAll(line, rest...);
+    }
+
+   public:
+    LOGGER(const LOGGER &) = delete;
+    LOGGER &operator=(const LOGGER &) = delete;
+
+    static LOGGER &instance();
+
+    static bool isEnabled(LOGLEVEL level) { return static_cast<int>(level) >= runtimeLevel.load(memory_order_relaxed); }
+    static void setLevel(LOGLEVEL level);
+    static LOGLEVEL getLevel();
+
+    template <typename... Args>
+    static void write(LOGLEVEL level, const Args &...args) {
+        LOGLINE line;
+        appendAll(line, args...);
+        instance().push(level, line);
+    }
+
+    void setSink(LOGSINK newSink);  // Default sink forwards to qDebug/qWarning
+    void flush();                   // Drains everything queued so far on the calling thread
+    size_t getDroppedCount() const;
+};
+
+bool parseLogLevel(const QString &name, LOGLEVEL &level);
+const char *logLevelName(LOGLEVEL level);
+
+#endif  // LOGGER_H
@@ -33,6 +33,24 @@ void SUBJECT::notifyTripUpdated(const string &tripID) {
     }
 }
 
+void SUBJECT::notifyTripsAdded(const vector<string> &tripIDs) {
+    for (size_t i = 0; i < observers.size(); ++i) {
+        observers[i]->onTripsAdded(tripIDs);
+    }
+}
+
+void SUBJECT::notifyTripsRemoved(const vector<string> &tripIDs) {
+    for (size_t i = 0; i < observers.size(); ++i) {
+        observers[i]->onTripsRemoved(tripIDs);
+    }
+}
+
+void SUBJECT::notifyTripsUpdated(const vector<string> &tripIDs) {
+    for (size_t i = 0; i < observers.size(); ++i) {
+        observers[i]->onTripsUpdated(tripIDs);
+    }
+}
+
 // Person notification methods
 void SUBJECT::notifyPersonAdded(const string &personID) {
     for (size_t i = 0; i < observers.size(); ++i) {
@@ -50,4 +68,22 @@ void SUBJECT::notifyPersonUpdated(const string &personID) {
     for (size_t i = 0; i < observers.size(); ++i) {
         observers[i]->onPersonUpdated(personID);
     }
-}
\ No newline at end of file
+}
+
+void SUBJECT::notifyPeopleAdded(const vector<string> &personIDs) {
+    for (size_t i = 0; i < observers.size(); ++i) {
+        observers[i]->onPeopleAdded(personIDs);
+    }
+}
+
+void SUBJECT::notifyPeopleRemoved(const vector<string> &personIDs) {
+    for (size_t i = 0; i < observers.size(); ++i) {
+        observers[i]->onPeopleRemoved(personIDs);
+    }
+}
+
+void SUBJECT::notifyPersonRenamed(const string &oldID, const string &newID) {
+    for (size_t i = 0; i < observers.size(); ++i) {
+        observers[i]->onPersonRenamed(oldID, newID);
+    }
+}
@@ -16,10 +16,47 @@ class OBSERVER {
     virtual void onTripRemoved(const string &tripID) = 0;
     virtual void onTripUpdated(const string &tripID) = 0;
 
+    // Bulk notification (imports); observers that can refresh once override it
+    virtual void onTripsAdded(const vector<string> &tripIDs) {
+        for (const string &tripID : tripIDs) {
+            onTripAdded(tripID);
+        }
+    }
+
+    virtual void onTripsRemoved(const vector<string> &tripIDs) {
+        for (const string &tripID : tripIDs) {
+            onTripRemoved(tripID);
+        }
+    }
+
+    virtual void onTripsUpdated(const vector<string> &tripIDs) {
+        for (const string &tripID : tripIDs) {
+            onTripUpdated(tripID);
+        }
+    }
+
     // Person notifications - separate methods
     virtual void onPersonAdded(const string &personID) = 0;
     virtual void onPersonRemoved(const string &personID) = 0;
     virtual void onPersonUpdated(const string &personID) = 0;
+
+    virtual void onPeopleAdded(const vector<string> &personIDs) {
+        for (const string &personID : personIDs) {
+            onPersonAdded(personID);
+        }
+    }
+
+    // An edit that changed the person's ID; observers keyed by ID override this
+    virtual void onPersonRenamed(const string &oldID, const string &newID) {
+        (void)oldID;
+        onPersonUpdated(newID);
+    }
+
+    virtual void onPeopleRemoved(const vector<string> &personIDs) {
+        for (const string &personID : personIDs) {
+            onPersonRemoved(personID);
+        }
+    }
 };
 
 // CLASS: Subject (renamed to be more generic)
@@ -35,11 +72,17 @@ class SUBJECT {
     void notifyTripAdded(const string &tripID);
     void notifyTripRemoved(const string &tripID);
     void notifyTripUpdated(const string &tripID);
+    void notifyTripsAdded(const vector<string> &tripIDs);
+    void notifyTripsRemoved(const vector<string> &tripIDs);
+    void notifyTripsUpdated(const vector<string> &tripIDs);
 
     // Person notification methods
     void notifyPersonAdded(const string &personID);
     void notifyPersonRemoved(const string &personID);
     void notifyPersonUpdated(const string &personID);
+    void notifyPeopleAdded(const vector<string> &personIDs);
+    void notifyPeopleRemoved(const vector<string> &personIDs);
+    void notifyPersonRenamed(const string &oldID, const string &newID);
 };
 
 #endif  // OBSERVER_H
\ No newline at end of file
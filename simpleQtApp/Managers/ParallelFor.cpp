@@ -0,0 +1,28 @@
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// FUNC: Run work(0..count-1) on up to hardware_concurrency threads; returns the thread count used
+int parallelFor(size_t count, const function<void(size_t)> &work) {
+    size_t threadCount = min<size_t>(count, max(1u, thread::hardware_concurrency()));
+    if (threadCount <= 1) {
+        for (size_t i = 0; i < count; ++i) work(i);
+        return 1;
+    }
+
+    atomic<size_t> next(0);
+    vector<thread> workers;
+    workers.reserve(threadCount);
+    for (size_t t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&]() {
+            for (size_t i = next++; i < count; i = next++) work(i);
+        });
+    }
+    for (thread &worker : workers) worker.join();
+    return static_cast<int>(threadCount);
+}
@@ -0,0 +1,13 @@
+#ifndef PARALLELFOR_H
+#define PARALLELFOR_H
+
+#include <cstddef>
+#include <functional>
+
+using namespace std;
+
+// Runs work(0..count-1) on up to hardware_concurrency threads, each taking the next index as it
+// finishes one; returns the thread count used. Shared by the snapshot codec and the validator.
+int parallelFor(size_t count, const function<void(size_t)> &work);
+
+#endif  // PARALLELFOR_H
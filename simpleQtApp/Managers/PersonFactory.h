@@ -2,6 +2,7 @@
 #define PERSONFACTORY_H
 
 #include "../Models/header.h"
+#include "IdAllocator.h"
 
 using namespace std;
 
@@ -16,6 +17,7 @@ class PERSONFACTORY {
     static MEMBER createMember(const string &fullName, const GENDER &gender, const DATE &dob);
     static HOST createHost(const string &fullName, const GENDER &gender, const DATE &dob);
 
-    static string generatePersonID(const string &fullName, const DATE &dob);
+    static string generatePersonID(const string &fullName, const DATE &dob);  // Base ID, may be taken
+    static string generatePersonID(const string &fullName, const DATE &dob, IDALLOCATOR &ids);
 };
 #endif  // PERSONFACTORY_H
\ No newline at end of file
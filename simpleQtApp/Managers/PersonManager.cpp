@@ -1,54 +1,473 @@
 #include "PersonManager.h"
 
-#include <QDebug>
 #include <algorithm>
+#include <type_traits>
+#include <unordered_set>
+
+#include "DataValidator.h"
+#include "Logger.h"
 
 using namespace std;
 
-PERSONMANAGER::PERSONMANAGER() : peopleNeedsUpdate(true) {
-    // Load people from cache file if it exists
-    if (peopleCacheFileExists()) {
-        loadPeopleCacheFile(members, hosts);  // Load into separate vectors
-        refreshPeopleVector();                // Update composite vector
+namespace {
+
+// One filter holds all three key kinds; the seed keeps an ID from matching an equal phone number
+const quint64 ID_KEY_SEED = 1;
+const quint64 EMAIL_KEY_SEED = 2;
+const quint64 PHONE_KEY_SEED = 3;
+const size_t KEYS_PER_PERSON = 3;
+
+// FUNC: Fix an ID index after people.erase(position) without rebuilding it. Later records moved
+// down by one; a later record with the removed ID takes its place (first occurrence wins).
+template <typename PERSONTYPE>
+void unindexPosition(unordered_map<string, size_t> &index, const vector<PERSONTYPE> &people, const string &removedID,
+                     size_t position) {
+    index.erase(removedID);
+    for (size_t i = position; i < people.size(); ++i) {
+        auto found = index.find(people[i].getID());
+        if (found == index.end()) {
+            index.emplace(people[i].getID(), i);
+        } else if (found->second == i + 1) {
+            found->second = i;
+        }
+    }
+}
+
+// FUNC: Re-key the record at position, which now carries a new ID
+template <typename PERSONTYPE>
+void renameIndexed(unordered_map<string, size_t> &index, const vector<PERSONTYPE> &people, const string &oldID,
+                   size_t position) {
+    index.erase(oldID);
+    for (size_t i = position + 1; i < people.size(); ++i) {
+        if (people[i].getID() == oldID) {
+            index.emplace(oldID, i);
+            break;
+        }
+    }
+    auto found = index.find(people[position].getID());
+    if (found == index.end()) {
+        index.emplace(people[position].getID(), position);
+    } else if (found->second > position) {
+        found->second = position;
+    }
+}
+
+}  // namespace
+
+string normalizeEmail(const string &email) {
+    size_t first = email.find_first_not_of(" \t");
+    if (first == string::npos) {
+        return string();
+    }
+    size_t last = email.find_last_not_of(" \t");
+    string normalized = email.substr(first, last - first + 1);
+    for (char &c : normalized) {
+        c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    }
+    return normalized;
+}
+
+string normalizePhone(const string &phone) {
+    string digits;
+    digits.reserve(phone.size());
+    for (char c : phone) {
+        if (isdigit(static_cast<unsigned char>(c))) {
+            digits += c;
+        }
     }
-    qDebug() << "PersonManager initialized with" << members.size() << "members and" << hosts.size() << "hosts";
+    return digits;
+}
+
+PERSONMANAGER::PERSONMANAGER(bool loadCache)
+    : staleKnownKeys(0),
+      cacheLoaded(loadCache),
+      store(createPersonStore(selectedStorageBackend())) {
+    // Load people from the store (otherwise the caller hands them over later)
+    if (loadCache) {
+        store->load(members, hosts);  // Load into separate vectors
+        rebuildPersonIndex();
+        rebuildKnownKeys();
+    }
+    LOG_INFO("PersonManager initialized with", members.size(), "members and", hosts.size(), "hosts");
 }
 
 PERSONMANAGER::~PERSONMANAGER() {
-    // Save to cache before destruction
-    updatePeopleCacheFile(members, hosts);  // Save separate vectors
-    qDebug() << "PersonManager destroyed, saved" << getPersonCount() << "people to cache";
+    // Never overwrite the cache with a half-loaded state
+    if (!cacheLoaded) {
+        LOG_DEBUG("PersonManager destroyed before the cache was loaded, cache left untouched");
+        return;
+    }
+
+    // Every mutation is written as it happens, so this only runs after a failed write
+    if (!changes.isDirty()) {
+        LOG_DEBUG("PersonManager destroyed, cache already up to date");
+        return;
+    }
+
+    persistChanges();
+    store->flush();
+    LOG_INFO("PersonManager destroyed, saved", members.size() + hosts.size(), "people to cache");
+}
+
+void PERSONMANAGER::saveChanges() { persistChanges(); }
+
+// FUNC: Write whatever changed since the last save (no-op when clean)
+void PERSONMANAGER::persistChanges() {
+    if (!changes.isDirty()) {
+        changes.markSaved();
+        return;
+    }
+
+    if (store->applyDelta(getPendingDelta(), members, hosts)) {
+        changes.markSaved();
+    } else {
+        LOG_ERROR("PersonManager: could not write people to the", store->getName(), "store");
+    }
+}
+
+// FUNC: Rebuild the ID and contact lookups after positions shift
+void PERSONMANAGER::rebuildPersonIndex() {
+    memberIndex.clear();
+    memberIndex.reserve(members.size());
+    for (size_t i = 0; i < members.size(); ++i) {
+        memberIndex.emplace(members[i].getID(), i);
+    }
+    hostIndex.clear();
+    hostIndex.reserve(hosts.size());
+    for (size_t i = 0; i < hosts.size(); ++i) {
+        hostIndex.emplace(hosts[i].getID(), i);
+    }
+
+    emailOwners.clear();
+    phoneOwners.clear();
+    for (const MEMBER &member : members) indexContacts(member);
+    for (const HOST &host : hosts) indexContacts(host);
+}
+
+void PERSONMANAGER::indexContacts(const PERSON &person) {
+    string email = normalizeEmail(person.getEmail());
+    if (!email.empty()) emailOwners.emplace(move(email), person.getID());
+    string phone = normalizePhone(person.getPhoneNumber());
+    if (!phone.empty()) phoneOwners.emplace(move(phone), person.getID());
 }
 
+void PERSONMANAGER::unindexContacts(const PERSON &person) {
+    auto unindex = [&person](unordered_multimap<string, string> &owners, const string &key) {
+        auto range = owners.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == person.getID()) {
+                owners.erase(it);
+                return;
+            }
+        }
+    };
+    unindex(emailOwners, normalizeEmail(person.getEmail()));
+    unindex(phoneOwners, normalizePhone(person.getPhoneNumber()));
+}
+
+// FUNC: Pre-filter first (most typed values are new), then one hash probe
+string PERSONMANAGER::findContactOwner(const unordered_multimap<string, string> &owners, const string &key,
+                                       quint64 seed, const string &excludeID) const {
+    if (key.empty() || !knownKeys.mayContain(bloomHash(key, seed))) {
+        return string();
+    }
+    auto range = owners.equal_range(key);
+    if (range.first == range.second) {
+        knownKeys.recordFalsePositive();
+    }
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second != excludeID) {
+            return it->second;
+        }
+    }
+    return string();
+}
+
+string PERSONMANAGER::findEmailOwner(const string &email, const string &excludeID) const {
+    return findContactOwner(emailOwners, normalizeEmail(email), EMAIL_KEY_SEED, excludeID);
+}
+
+string PERSONMANAGER::findPhoneOwner(const string &phone, const string &excludeID) const {
+    return findContactOwner(phoneOwners, normalizePhone(phone), PHONE_KEY_SEED, excludeID);
+}
+
+// FUNC: Size the pre-filter with room to double before the next rebuild
+void PERSONMANAGER::rebuildKnownKeys() {
+    size_t expectedKeys = 2 * KEYS_PER_PERSON * (members.size() + hosts.size());
+    knownKeys.reset(expectedKeys, selectedBloomFalsePositiveRate());
+    staleKnownKeys = 0;
+    for (const MEMBER &member : members) addKnownKeys(member);
+    for (const HOST &host : hosts) addKnownKeys(host);
+}
+
+void PERSONMANAGER::addKnownKeys(const PERSON &person) {
+    knownKeys.add(bloomHash(person.getID(), ID_KEY_SEED));
+    string email = normalizeEmail(person.getEmail());
+    if (!email.empty()) knownKeys.add(bloomHash(email, EMAIL_KEY_SEED));
+    string phone = normalizePhone(person.getPhoneNumber());
+    if (!phone.empty()) knownKeys.add(bloomHash(phone, PHONE_KEY_SEED));
+
+    if (knownKeys.isOverCapacity()) {
+        rebuildKnownKeys();
+    }
+}
+
+// FUNC: Bloom filters cannot delete; once half the keys are stale the rate is worth a rebuild
+void PERSONMANAGER::forgetKnownKeys(size_t peopleRemoved) {
+    staleKnownKeys += KEYS_PER_PERSON * peopleRemoved;
+    if (staleKnownKeys > knownKeys.getKeyCount() / 2) {
+        rebuildKnownKeys();
+    }
+}
+
+// FUNC: Integrity - one probe of each ID index
+vector<VALIDATIONISSUE> PERSONMANAGER::checkPersonID(const string &id, bool asHost, const string &previousID) const {
+    vector<VALIDATIONISSUE> issues;
+    if (id == previousID) {
+        return issues;
+    }
+    if (memberIndex.count(id)) {
+        issues.push_back({asHost ? VALIDATIONCHECK::CrossRoleID : VALIDATIONCHECK::DuplicateMemberID, id,
+                          "already a member"});
+    }
+    if (hostIndex.count(id)) {
+        issues.push_back(
+            {asHost ? VALIDATIONCHECK::DuplicateHostID : VALIDATIONCHECK::CrossRoleID, id, "already a host"});
+    }
+    return issues;
+}
+
+bool PERSONMANAGER::admitPerson(const PERSON &person, bool asHost, const string &previousID, const char *operation) {
+    if (!integrity.isEnabled()) {
+        return true;
+    }
+    integrity.begin();
+    bool admitted = integrity.admit(checkPersonID(person.getID(), asHost, previousID));
+    integrity.end(operation);
+    return admitted;
+}
+
+INTEGRITYGUARD &PERSONMANAGER::getIntegrityGuard() { return integrity; }
+
+const INTEGRITYGUARD &PERSONMANAGER::getIntegrityGuard() const { return integrity; }
+
 // FUNC: Add person (delegates to appropriate vector)
-void PERSONMANAGER::addPerson(const PERSON &person) {
+bool PERSONMANAGER::addPerson(const PERSON &person) {
     if (person.getRole() == "Member") {
         const MEMBER &member = static_cast<const MEMBER &>(person);
-        addMember(member);
+        return addMember(member);
     } else if (person.getRole() == "Host") {
         const HOST &host = static_cast<const HOST &>(person);
-        addHost(host);
+        return addHost(host);
     }
+    return false;
 }
 
 // FUNC: Add member directly
-void PERSONMANAGER::addMember(const MEMBER &member) {
+bool PERSONMANAGER::addMember(const MEMBER &member) {
+    if (!admitPerson(member, false, string(), "addMember")) {
+        return false;
+    }
+
     members.push_back(member);
-    peopleNeedsUpdate = true;
+    memberIndex.emplace(member.getID(), members.size() - 1);
+    indexContacts(member);
+    addKnownKeys(member);
+    changes.recordAdded(member.getID(), memberContentHash(member));
 
     notifyPersonAdded(member.getID());
-    updatePeopleCacheFile(members, hosts);
-    qDebug() << "Added member:" << QString::fromStdString(member.getFullName());
+    persistChanges();
+    LOG_TRACE("Added member:", member.getFullName());
+    return true;
 }
 
 // FUNC: Add host directly
-void PERSONMANAGER::addHost(const HOST &host) {
+bool PERSONMANAGER::addHost(const HOST &host) {
+    if (!admitPerson(host, true, string(), "addHost")) {
+        return false;
+    }
+
     hosts.push_back(host);
-    peopleNeedsUpdate = true;
+    hostIndex.emplace(host.getID(), hosts.size() - 1);
+    indexContacts(host);
+    addKnownKeys(host);
+    changes.recordAdded(host.getID(), hostContentHash(host));
 
     notifyPersonAdded(host.getID());
-    updatePeopleCacheFile(members, hosts);
-    qDebug() << "Added host:" << QString::fromStdString(host.getFullName());
+    persistChanges();
+    LOG_TRACE("Added host:", host.getFullName());
+    return true;
+}
+
+// FUNC: Bulk add - one notification and one store write for the whole batch
+void PERSONMANAGER::addMultipleMembers(const vector<MEMBER> &newMembers) {
+    if (newMembers.empty()) {
+        return;
+    }
+
+    vector<string> addedIDs;
+    addedIDs.reserve(newMembers.size());
+    members.reserve(members.size() + newMembers.size());
+    integrity.begin();
+    for (const MEMBER &member : newMembers) {
+        if (integrity.isEnabled()) {
+            integrity.admit(checkPersonID(member.getID(), false), false);  // Bulk loads are reported, not dropped
+        }
+        members.push_back(member);
+        memberIndex.emplace(member.getID(), members.size() - 1);
+        indexContacts(member);
+        addKnownKeys(member);
+        changes.recordAdded(member.getID(), memberContentHash(member));
+        addedIDs.push_back(member.getID());
+    }
+
+    integrity.end("addMultipleMembers");
+    notifyPeopleAdded(addedIDs);
+    persistChanges();
+    LOG_DEBUG("Added", newMembers.size(), "members");
+}
+
+void PERSONMANAGER::addMultipleHosts(const vector<HOST> &newHosts) {
+    if (newHosts.empty()) {
+        return;
+    }
+
+    vector<string> addedIDs;
+    addedIDs.reserve(newHosts.size());
+    hosts.reserve(hosts.size() + newHosts.size());
+    integrity.begin();
+    for (const HOST &host : newHosts) {
+        if (integrity.isEnabled()) {
+            integrity.admit(checkPersonID(host.getID(), true), false);
+        }
+        hosts.push_back(host);
+        hostIndex.emplace(host.getID(), hosts.size() - 1);
+        indexContacts(host);
+        addKnownKeys(host);
+        changes.recordAdded(host.getID(), hostContentHash(host));
+        addedIDs.push_back(host.getID());
+    }
+
+    integrity.end("addMultipleHosts");
+    notifyPeopleAdded(addedIDs);
+    persistChanges();
+    LOG_DEBUG("Added", newHosts.size(), "hosts");
+}
+
+// FUNC: Bulk import - duplicates are found through the ID index, the rest is appended in one pass
+// Most rows of a large merge are new: the pre-filter answers those without probing the index.
+PEOPLEIMPORTRESULT PERSONMANAGER::importPeople(vector<MEMBER> &&newMembers, vector<HOST> &&newHosts) {
+    PEOPLEIMPORTRESULT result;
+    result.addedIDs.reserve(newMembers.size() + newHosts.size());
+    members.reserve(members.size() + newMembers.size());
+    hosts.reserve(hosts.size() + newHosts.size());
+
+    // Added records go into the index straight away, so repeats within the batch are caught too
+    auto isKnown = [this](const string &id) {
+        if (!knownKeys.mayContain(bloomHash(id, ID_KEY_SEED))) {
+            return false;
+        }
+        if (memberIndex.count(id) != 0 || hostIndex.count(id) != 0) {
+            return true;
+        }
+        knownKeys.recordFalsePositive();
+        return false;
+    };
+
+    // Shared contacts are imported but reported, the same index the add/edit dialogs check
+    auto checkContacts = [this, &result](const PERSON &person) {
+        if (!findEmailOwner(person.getEmail()).empty() || !findPhoneOwner(person.getPhoneNumber()).empty()) {
+            result.contactConflictIDs.push_back(person.getID());
+        }
+    };
+
+    // Base IDs repeat whenever initials and birthday do: only the same name and birth date is a
+    // duplicate, anyone else takes the next free suffix
+    IDALLOCATOR ids(isKnown);
+    auto claimID = [this, &ids, &result](PERSON &person) {
+        string id = ids.allocate(person.getID(), [this, &person](const string &heldID) {
+            const PERSON *holder = findPersonById(heldID);
+            return holder && isSamePerson(*holder, person);
+        });
+        if (id.empty()) {
+            result.duplicateIDs.push_back(person.getID());
+            return false;
+        }
+        person.setID(id);
+        return true;
+    };
+
+    for (MEMBER &member : newMembers) {
+        if (!claimID(member)) continue;
+        checkContacts(member);
+        changes.recordAdded(member.getID(), memberContentHash(member));
+        members.push_back(move(member));
+        memberIndex.emplace(members.back().getID(), members.size() - 1);
+        indexContacts(members.back());
+        addKnownKeys(members.back());
+        result.addedIDs.push_back(members.back().getID());
+        result.membersAdded++;
+    }
+
+    for (HOST &host : newHosts) {
+        if (!claimID(host)) continue;
+        checkContacts(host);
+        changes.recordAdded(host.getID(), hostContentHash(host));
+        hosts.push_back(move(host));
+        hostIndex.emplace(hosts.back().getID(), hosts.size() - 1);
+        indexContacts(hosts.back());
+        addKnownKeys(hosts.back());
+        result.addedIDs.push_back(hosts.back().getID());
+        result.hostsAdded++;
+    }
+
+    newMembers.clear();
+    newHosts.clear();
+    if (result.addedIDs.empty()) {
+        return result;
+    }
+
+    notifyPeopleAdded(result.addedIDs);
+    BLOOMSTATS filter = knownKeys.getStats();
+    LOG_DEBUG("Imported", result.membersAdded, "members and", result.hostsAdded, "hosts,",
+              result.duplicateIDs.size(), "duplicates skipped,", result.contactConflictIDs.size(),
+              "with a shared email or phone");
+    LOG_INFO("Duplicate pre-filter:", filter.definiteMisses, "definite misses,", filter.falsePositives,
+             "false positives; rate observed", filter.observedRate(), "estimated", filter.estimatedRate, "target",
+             filter.targetRate);
+    return result;
+}
+
+// FUNC: Bulk remove (import rollback) - each vector is compacted once
+size_t PERSONMANAGER::removePeople(const vector<string> &personIDs) {
+    unordered_set<string> doomed(personIDs.begin(), personIDs.end());
+    vector<string> removedIDs;
+
+    auto compact = [&](auto &records, auto contentHash) {
+        using RECORD = typename std::decay<decltype(records)>::type::value_type;
+        auto keptEnd = remove_if(records.begin(), records.end(), [&](const RECORD &record) {
+            if (!doomed.count(record.getID())) {
+                return false;
+            }
+            changes.recordRemoved(record.getID(), contentHash(record));
+            removedIDs.push_back(record.getID());
+            return true;
+        });
+        records.erase(keptEnd, records.end());
+    };
+    compact(members, memberContentHash);
+    compact(hosts, hostContentHash);
+
+    if (removedIDs.empty()) {
+        return 0;
+    }
+    rebuildPersonIndex();
+    forgetKnownKeys(removedIDs.size());
+
+    notifyPeopleRemoved(removedIDs);
+    persistChanges();
+    LOG_DEBUG("Removed", removedIDs.size(), "people");
+    return removedIDs.size();
 }
 
 // FUNC: Remove person (searches both vectors)
@@ -63,16 +482,21 @@ bool PERSONMANAGER::removePerson(const string &personID) {
 
 // FUNC: Remove member directly
 bool PERSONMANAGER::removeMember(const string &memberID) {
-    auto it = find_if(members.begin(), members.end(),
-                      [&memberID](const MEMBER &member) { return member.getID() == memberID; });
-
-    if (it != members.end()) {
+    auto found = memberIndex.find(memberID);
+
+    if (found != memberIndex.end()) {
+        size_t position = found->second;
+        auto it = members.begin() + position;
+        string removedID = memberID;  // memberID may refer to the record being erased
+        changes.recordRemoved(removedID, memberContentHash(*it));
+        unindexContacts(*it);
         members.erase(it);
-        peopleNeedsUpdate = true;
+        unindexPosition(memberIndex, members, removedID, position);
+        forgetKnownKeys(1);
 
-        notifyPersonRemoved(memberID);
-        updatePeopleCacheFile(members, hosts);
-        qDebug() << "Removed member:" << QString::fromStdString(memberID);
+        notifyPersonRemoved(removedID);
+        persistChanges();
+        LOG_TRACE("Removed member:", removedID);
         return true;
     }
     return false;
@@ -80,15 +504,21 @@ bool PERSONMANAGER::removeMember(const string &memberID) {
 
 // FUNC: Remove host directly
 bool PERSONMANAGER::removeHost(const string &hostID) {
-    auto it = find_if(hosts.begin(), hosts.end(), [&hostID](const HOST &host) { return host.getID() == hostID; });
-
-    if (it != hosts.end()) {
+    auto found = hostIndex.find(hostID);
+
+    if (found != hostIndex.end()) {
+        size_t position = found->second;
+        auto it = hosts.begin() + position;
+        string removedID = hostID;  // hostID may refer to the record being erased
+        changes.recordRemoved(removedID, hostContentHash(*it));
+        unindexContacts(*it);
         hosts.erase(it);
-        peopleNeedsUpdate = true;
+        unindexPosition(hostIndex, hosts, removedID, position);
+        forgetKnownKeys(1);
 
-        notifyPersonRemoved(hostID);
-        updatePeopleCacheFile(members, hosts);
-        qDebug() << "Removed host:" << QString::fromStdString(hostID);
+        notifyPersonRemoved(removedID);
+        persistChanges();
+        LOG_TRACE("Removed host:", removedID);
         return true;
     }
     return false;
@@ -101,10 +531,13 @@ bool PERSONMANAGER::updatePerson(const PERSON &originalPerson, const PERSON &upd
     } else if (originalPerson.getRole() == "Host" && updatedPerson.getRole() == "Host") {
         return updateHost(static_cast<const HOST &>(originalPerson), static_cast<const HOST &>(updatedPerson));
     } else {
-        // Role change - remove from old and add to new
+        // Role change - remove from old and add to new; checked first so a rejection keeps the original
+        bool toHost = updatedPerson.getRole() == "Host";
+        if (!admitPerson(updatedPerson, toHost, originalPerson.getID(), "updatePerson")) {
+            return false;
+        }
         if (removePerson(originalPerson.getID())) {
-            addPerson(updatedPerson);
-            return true;
+            return addPerson(updatedPerson);
         }
     }
     return false;
@@ -112,16 +545,33 @@ bool PERSONMANAGER::updatePerson(const PERSON &originalPerson, const PERSON &upd
 
 // FUNC: Update member directly
 bool PERSONMANAGER::updateMember(const MEMBER &originalMember, const MEMBER &updatedMember) {
-    auto it = find_if(members.begin(), members.end(),
-                      [&originalMember](const MEMBER &member) { return member.getID() == originalMember.getID(); });
+    auto found = memberIndex.find(originalMember.getID());
 
-    if (it != members.end()) {
+    if (found != memberIndex.end()) {
+        if (!admitPerson(updatedMember, false, originalMember.getID(), "updateMember")) {
+            return false;
+        }
+        auto it = members.begin() + found->second;
+        string originalID = originalMember.getID();  // originalMember may be the record about to be overwritten
+        quint64 oldHash = memberContentHash(*it);
+        unindexContacts(*it);
         *it = updatedMember;
-        peopleNeedsUpdate = true;
-
-        notifyPersonUpdated(updatedMember.getID());
-        updatePeopleCacheFile(members, hosts);
-        qDebug() << "Updated member:" << QString::fromStdString(updatedMember.getID());
+        indexContacts(updatedMember);
+        forgetKnownKeys(1);
+        addKnownKeys(updatedMember);
+
+        // IDs derive from name and birth date, so an edit can rename the record
+        if (originalID == updatedMember.getID()) {
+            changes.recordUpdated(updatedMember.getID(), oldHash, memberContentHash(updatedMember));
+            notifyPersonUpdated(updatedMember.getID());
+        } else {
+            changes.recordRemoved(originalID, oldHash);
+            changes.recordAdded(updatedMember.getID(), memberContentHash(updatedMember));
+            renameIndexed(memberIndex, members, originalID, static_cast<size_t>(it - members.begin()));
+            notifyPersonRenamed(originalID, updatedMember.getID());
+        }
+        persistChanges();
+        LOG_TRACE("Updated member:", updatedMember.getID());
         return true;
     }
     return false;
@@ -129,16 +579,32 @@ bool PERSONMANAGER::updateMember(const MEMBER &originalMember, const MEMBER &upd
 
 // FUNC: Update host directly
 bool PERSONMANAGER::updateHost(const HOST &originalHost, const HOST &updatedHost) {
-    auto it = find_if(hosts.begin(), hosts.end(),
-                      [&originalHost](const HOST &host) { return host.getID() == originalHost.getID(); });
+    auto found = hostIndex.find(originalHost.getID());
 
-    if (it != hosts.end()) {
+    if (found != hostIndex.end()) {
+        if (!admitPerson(updatedHost, true, originalHost.getID(), "updateHost")) {
+            return false;
+        }
+        auto it = hosts.begin() + found->second;
+        string originalID = originalHost.getID();  // originalHost may be the record about to be overwritten
+        quint64 oldHash = hostContentHash(*it);
+        unindexContacts(*it);
         *it = updatedHost;
-        peopleNeedsUpdate = true;
-
-        notifyPersonUpdated(updatedHost.getID());
-        updatePeopleCacheFile(members, hosts);
-        qDebug() << "Updated host:" << QString::fromStdString(updatedHost.getID());
+        indexContacts(updatedHost);
+        forgetKnownKeys(1);
+        addKnownKeys(updatedHost);
+
+        if (originalID == updatedHost.getID()) {
+            changes.recordUpdated(updatedHost.getID(), oldHash, hostContentHash(updatedHost));
+            notifyPersonUpdated(updatedHost.getID());
+        } else {
+            changes.recordRemoved(originalID, oldHash);
+            changes.recordAdded(updatedHost.getID(), hostContentHash(updatedHost));
+            renameIndexed(hostIndex, hosts, originalID, static_cast<size_t>(it - hosts.begin()));
+            notifyPersonRenamed(originalID, updatedHost.getID());
+        }
+        persistChanges();
+        LOG_TRACE("Updated host:", updatedHost.getID());
         return true;
     }
     return false;
@@ -159,8 +625,11 @@ bool PERSONMANAGER::updatePeople(const vector<PERSON> &updatedPeople) {
         }
     }
 
-    peopleNeedsUpdate = true;
-    updatePeopleCacheFile(members, hosts);
+    rebuildPersonIndex();
+    rebuildKnownKeys();
+    if (store->saveSnapshot(members, hosts)) {
+        changes.markSaved();  // Hashes are relative to the last save, so the new baseline is clean
+    }
     return true;
 }
 
@@ -183,24 +652,25 @@ PERSON *PERSONMANAGER::findPersonById(const string &id) {
 
 // FUNC: Find member by ID
 MEMBER *PERSONMANAGER::findMemberById(const string &id) {
-    auto it = find_if(members.begin(), members.end(), [&id](const MEMBER &member) { return member.getID() == id; });
-    return (it != members.end()) ? &(*it) : nullptr;
+    auto it = memberIndex.find(id);
+    return (it != memberIndex.end()) ? &members[it->second] : nullptr;
 }
 
 // FUNC: Find host by ID
 HOST *PERSONMANAGER::findHostById(const string &id) {
-    auto it = find_if(hosts.begin(), hosts.end(), [&id](const HOST &host) { return host.getID() == id; });
-    return (it != hosts.end()) ? &(*it) : nullptr;
+    auto it = hostIndex.find(id);
+    return (it != hostIndex.end()) ? &hosts[it->second] : nullptr;
 }
 
-// FUNC: Get all people (composite view)
-const vector<PERSON> &PERSONMANAGER::getAllPeople() const {
-    if (peopleNeedsUpdate) {
-        refreshPeopleVector();
-    }
-    return people;
+IDALLOCATOR PERSONMANAGER::makeIDAllocator(const string &keepID) const {
+    return IDALLOCATOR([this, keepID](const string &id) {
+        return id != keepID && (memberIndex.count(id) != 0 || hostIndex.count(id) != 0);
+    });
 }
 
+// FUNC: Get all people (members then hosts, by reference)
+PEOPLEVIEW PERSONMANAGER::getAllPeople() const { return PEOPLEVIEW(members, hosts); }
+
 // FUNC: Get all members (direct access)
 const vector<MEMBER> &PERSONMANAGER::getAllMembers() const { return members; }
 
@@ -217,32 +687,8 @@ vector<HOST> PERSONMANAGER::getAllHostsLegacy() const {
     return hosts;  // Return copy
 }
 
-// FUNC: Refresh people vector (maintains composite view)
-void PERSONMANAGER::refreshPeopleVector() const {
-    people.clear();
-    people.reserve(members.size() + hosts.size());
-
-    // Add all members
-    for (const MEMBER &member : members) {
-        people.push_back(member);
-    }
-
-    // Add all hosts
-    for (const HOST &host : hosts) {
-        people.push_back(host);
-    }
-
-    peopleNeedsUpdate = false;
-    qDebug() << "Refreshed people vector:" << people.size() << "total people";
-}
-
 // FUNC: Get count functions
-size_t PERSONMANAGER::getPersonCount() const {
-    if (peopleNeedsUpdate) {
-        refreshPeopleVector();
-    }
-    return people.size();
-}
+size_t PERSONMANAGER::getPersonCount() const { return members.size() + hosts.size(); }
 
 size_t PERSONMANAGER::getMemberCount() const { return members.size(); }
 
@@ -262,45 +708,55 @@ MEMBER PERSONMANAGER::getMemberByID(const string &memberID) {
 
 // FUNC: Debugging and validation helpers
 void PERSONMANAGER::debugPrintCounts() const {
-    qDebug() << "PersonManager Debug Counts:";
-    qDebug() << "  Members:" << members.size();
-    qDebug() << "  Hosts:" << hosts.size();
-    qDebug() << "  Total People:" << getPersonCount();
-    qDebug() << "  People needs update:" << peopleNeedsUpdate;
+    LOG_INFO("PersonManager Debug Counts: members", members.size(), "hosts", hosts.size(), "total people",
+             getPersonCount());
 }
 
+// FUNC: ID checks of the data validator (hash based, parallel); shared contacts are allowed here
 bool PERSONMANAGER::validateDataIntegrity() const {
+    VALIDATIONREPORT report = validateData(TRIPSNAPSHOT(), members, hosts);
     bool valid = true;
-
-    // Check for duplicate IDs within members
-    for (size_t i = 0; i < members.size(); ++i) {
-        for (size_t j = i + 1; j < members.size(); ++j) {
-            if (members[i].getID() == members[j].getID()) {
-                qDebug() << "Duplicate member ID found:" << QString::fromStdString(members[i].getID());
-                valid = false;
-            }
+    for (const VALIDATIONISSUE &issue : report.issues) {
+        if (issue.check == VALIDATIONCHECK::DuplicateMemberID || issue.check == VALIDATIONCHECK::DuplicateHostID ||
+            issue.check == VALIDATIONCHECK::CrossRoleID) {
+            LOG_WARNING(validationCheckName(issue.check), issue.recordID, issue.detail);
+            valid = false;
         }
     }
+    return valid;
+}
 
-    // Check for duplicate IDs within hosts
-    for (size_t i = 0; i < hosts.size(); ++i) {
-        for (size_t j = i + 1; j < hosts.size(); ++j) {
-            if (hosts[i].getID() == hosts[j].getID()) {
-                qDebug() << "Duplicate host ID found:" << QString::fromStdString(hosts[i].getID());
-                valid = false;
-            }
-        }
-    }
+// FUNC: Replace all people with already-loaded vectors (no cache write, no notifications)
+void PERSONMANAGER::loadFromSeparateVectors(const vector<MEMBER> &importedMembers, const vector<HOST> &importedHosts) {
+    members = importedMembers;
+    hosts = importedHosts;
+    rebuildPersonIndex();
+    rebuildKnownKeys();
+    cacheLoaded = true;
+    changes.markSaved();
+    LOG_INFO("PersonManager loaded", members.size(), "members and", hosts.size(), "hosts");
+}
 
-    // Check for IDs that exist in both vectors
-    for (const MEMBER &member : members) {
-        for (const HOST &host : hosts) {
-            if (member.getID() == host.getID()) {
-                qDebug() << "ID exists in both vectors:" << QString::fromStdString(member.getID());
-                valid = false;
-            }
+BLOOMSTATS PERSONMANAGER::getDuplicateFilterStats() const { return knownKeys.getStats(); }
+
+// FUNC: Dirty tracking
+bool PERSONMANAGER::hasUnsavedChanges() const { return changes.isDirty(); }
+
+PERSONDELTA PERSONMANAGER::getPendingDelta() const {
+    PERSONDELTA delta;
+    delta.removedIDs.assign(changes.getRemovedIDs().begin(), changes.getRemovedIDs().end());
+    for (const string &id : changes.getUpsertedIDs()) {
+        auto member = memberIndex.find(id);
+        if (member != memberIndex.end()) {
+            delta.upsertedMembers.push_back(members[member->second]);
+            continue;
+        }
+        auto host = hostIndex.find(id);
+        if (host != hostIndex.end()) {
+            delta.upsertedHosts.push_back(hosts[host->second]);
         }
     }
+    return delta;
+}
 
-    return valid;
-}
\ No newline at end of file
+const DIRTYTRACKER &PERSONMANAGER::getChangeTracker() const { return changes; }
@@ -1,11 +1,20 @@
 #ifndef PERSONMANAGER_H
 #define PERSONMANAGER_H
 
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "../Models/header.h"
+#include "BloomFilter.h"
+#include "DataStore.h"
+#include "DirtyTracker.h"
 #include "FileManager.h"
+#include "IdAllocator.h"
+#include "IntegrityGuard.h"
 #include "Observer.h"
 
 using namespace std;
@@ -13,24 +22,109 @@ using namespace std;
 // Forward declarations
 class OBSERVER;
 
+// CLASS: PEOPLEVIEW - every member, then every host, as const PERSON references
+// Nothing is copied, so records keep their real type (getRole() says Member or Host). Like any
+// reference into the manager, a view is only valid until the next add or remove.
+class PEOPLEVIEW {
+   private:
+    const vector<MEMBER> *members;
+    const vector<HOST> *hosts;
+
+   public:
+    // Holds the vectors rather than the view, so it stays valid after a temporary view is gone
+    class iterator {
+       private:
+        const vector<MEMBER> *members;
+        const vector<HOST> *hosts;
+        size_t position;
+
+       public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = PERSON;
+        using difference_type = ptrdiff_t;
+        using pointer = const PERSON *;
+        using reference = const PERSON &;
+
+        iterator(const vector<MEMBER> *members, const vector<HOST> *hosts, size_t position)
+            : members(members), hosts(hosts), position(position) {}
+
+        reference operator*() const { return PEOPLEVIEW(*members, *hosts)[position]; }
+        pointer operator->() const { return &**this; }
+        iterator &operator++() {
+            ++position;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator before = *this;
+            ++position;
+            return before;
+        }
+        bool operator==(const iterator &rhs) const { return position == rhs.position; }
+        bool operator!=(const iterator &rhs) const { return position != rhs.position; }
+    };
+
+    PEOPLEVIEW(const vector<MEMBER> &members, const vector<HOST> &hosts) : members(&members), hosts(&hosts) {}
+
+    iterator begin() const { return iterator(members, hosts, 0); }
+    iterator end() const { return iterator(members, hosts, size()); }
+    size_t size() const { return members->size() + hosts->size(); }
+    bool empty() const { return size() == 0; }
+
+    const PERSON &operator[](size_t index) const {
+        return index < members->size() ? static_cast<const PERSON &>((*members)[index])
+                                       : static_cast<const PERSON &>((*hosts)[index - members->size()]);
+    }
+};
+
+// Outcome of PERSONMANAGER::importPeople
+struct PEOPLEIMPORTRESULT {
+    vector<string> addedIDs;
+    vector<string> duplicateIDs;  // Same name and birth date as someone known or earlier in the batch
+    vector<string> contactConflictIDs;  // Added, but their email or phone already belongs to someone else
+    size_t membersAdded = 0;
+    size_t hostsAdded = 0;
+};
+
 class PERSONMANAGER : public SUBJECT {
    private:
     // Separate vectors for better maintenance and debugging
     vector<MEMBER> members;  // Store members separately
     vector<HOST> hosts;      // Store hosts separately
-
-    // Keep original vector for compatibility (mutable for lazy update)
-    mutable vector<PERSON> people;   // Composite view of all people
-    mutable bool peopleNeedsUpdate;  // Flag to track if people vector needs refresh
+    unordered_map<string, size_t> memberIndex;  // Member ID -> position in members (first occurrence wins)
+    unordered_map<string, size_t> hostIndex;    // Host ID -> position in hosts
+    unordered_multimap<string, string> emailOwners;  // Normalized email -> person ID (legacy data may share)
+    unordered_multimap<string, string> phoneOwners;  // Phone digits -> person ID
+    BLOCKEDBLOOMFILTER knownKeys;               // IDs, emails and phones; a miss skips the exact check
+    size_t staleKnownKeys;                      // Keys of removed or edited people still set in knownKeys
+
+    bool cacheLoaded;                // Cache is only written back once it has been read
+    unique_ptr<PERSONSTORE> store;   // Backend picked at startup
+    DIRTYTRACKER changes;            // Unsaved mutations since the last store write
+    INTEGRITYGUARD integrity;        // Per-mutation checks and what the last one found
+
+    void persistChanges();  // Hands the dirty region to the store
+    void rebuildPersonIndex();  // ID and contact indexes
+    void indexContacts(const PERSON &person);
+    void unindexContacts(const PERSON &person);
+    string findContactOwner(const unordered_multimap<string, string> &owners, const string &key, quint64 seed,
+                            const string &excludeID) const;
+    void rebuildKnownKeys();  // Resizes for the current population at the selected false-positive rate
+    void addKnownKeys(const PERSON &person);
+    void forgetKnownKeys(size_t peopleRemoved);
+
+    // ID clashes the person would introduce as a member or a host, unless they keep previousID
+    vector<VALIDATIONISSUE> checkPersonID(const string &id, bool asHost, const string &previousID = string()) const;
+    bool admitPerson(const PERSON &person, bool asHost, const string &previousID, const char *operation);
 
    public:
-    PERSONMANAGER();
+    explicit PERSONMANAGER(bool loadCache = true);
     ~PERSONMANAGER();  // Need explicit destructor to clean up
 
     // Core management functions
-    void addPerson(const PERSON &person);
-    void addMember(const MEMBER &member);  // NEW: Direct member addition
-    void addHost(const HOST &host);        // NEW: Direct host addition
+    // Adds and updates return false when strict integrity rejects them (see getIntegrityGuard)
+    bool addPerson(const PERSON &person);
+    bool addMember(const MEMBER &member);  // NEW: Direct member addition
+    bool addHost(const HOST &host);        // NEW: Direct host addition
 
     bool removePerson(const string &personID);
     bool removeMember(const string &memberID);  // NEW: Direct member removal
@@ -46,7 +140,18 @@ class PERSONMANAGER : public SUBJECT {
     MEMBER *findMemberById(const string &id);  // NEW: Direct member search
     HOST *findHostById(const string &id);      // NEW: Direct host search
 
-    const vector<PERSON> &getAllPeople() const;   // Returns composite view
+    // IDs unique among members and hosts; keepID is the person being edited, who may keep theirs
+    IDALLOCATOR makeIDAllocator(const string &keepID = string()) const;
+
+    INTEGRITYGUARD &getIntegrityGuard();
+    const INTEGRITYGUARD &getIntegrityGuard() const;
+
+    // Contact uniqueness: the ID of someone else using this email / phone, empty when it is free.
+    // Both are compared in normalized form; excludeID lets an edited person keep their own.
+    string findEmailOwner(const string &email, const string &excludeID = string()) const;
+    string findPhoneOwner(const string &phone, const string &excludeID = string()) const;
+
+    PEOPLEVIEW getAllPeople() const;              // Members then hosts, no copies
     const vector<MEMBER> &getAllMembers() const;  // NEW: Direct access to members
     const vector<HOST> &getAllHosts() const;      // NEW: Direct access to hosts
 
@@ -66,18 +171,34 @@ class PERSONMANAGER : public SUBJECT {
     // Bulk operations - NEW
     void addMultipleMembers(const vector<MEMBER> &newMembers);
     void addMultipleHosts(const vector<HOST> &newHosts);
+    // Bulk import: skips people already known, re-IDs clashes; one notification. Nothing is written:
+    // the caller calls saveChanges() once the whole file is in (or was rolled back).
+    PEOPLEIMPORTRESULT importPeople(vector<MEMBER> &&newMembers, vector<HOST> &&newHosts);
+    size_t removePeople(const vector<string> &personIDs);  // Members or hosts, one notification and one write
+    void saveChanges();  // Writes what is still unsaved, e.g. after an import
     void clearAllMembers();  // NEW: Clear all members
     void clearAllHosts();    // NEW: Clear all hosts
     void clearAll();         // NEW: Clear everything
 
     // Maintenance and debugging functions - NEW
-    void refreshPeopleVector() const;    // Force refresh of composite vector
     bool validateDataIntegrity() const;  // Check data consistency
     void debugPrintCounts() const;       // Print counts for debugging
 
     // Import/Export helpers - NEW
     void loadFromSeparateVectors(const vector<MEMBER> &importedMembers, const vector<HOST> &importedHosts);
     void exportToSeparateVectors(vector<MEMBER> &exportMembers, vector<HOST> &exportHosts) const;
+
+    // Duplicate pre-filter: target, estimated and observed false-positive rates
+    BLOOMSTATS getDuplicateFilterStats() const;
+
+    // Dirty tracking
+    bool hasUnsavedChanges() const;
+    PERSONDELTA getPendingDelta() const;
+    const DIRTYTRACKER &getChangeTracker() const;
 };
 
+// Forms used for duplicate checks: trimmed lower-case email, phone digits only
+string normalizeEmail(const string &email);
+string normalizePhone(const string &phone);
+
 #endif  // PERSONMANAGER_H
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "RelationshipIndex.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+const TRIPLINKS noPeople;
+const PERSONLINKS noTrips;
+
+void eraseValue(vector<string> &values, const string &value) {
+    auto it = find(values.begin(), values.end(), value);
+    if (it != values.end()) {
+        values.erase(it);
+    }
+}
+
+}  // namespace
+
+// CLASS: RELATIONSHIPINDEX
+
+void RELATIONSHIPINDEX::linkTrip(const TRIP &trip) {
+    TRIPLINKS &links = byTrip[trip.getID()];
+    if (trip.hasHost()) {
+        links.hostID = trip.getHost().getID();
+        byPerson[links.hostID].hostedTripIDs.push_back(trip.getID());
+    }
+    for (const MEMBER &member : trip.getMembers()) {
+        links.memberIDs.push_back(member.getID());
+        byPerson[member.getID()].joinedTripIDs.push_back(trip.getID());
+    }
+}
+
+void RELATIONSHIPINDEX::dropFromPerson(const string &personID, const string &tripID, bool hosted) {
+    auto person = byPerson.find(personID);
+    if (person == byPerson.end()) {
+        return;
+    }
+    eraseValue(hosted ? person->second.hostedTripIDs : person->second.joinedTripIDs, tripID);
+    if (person->second.empty()) {
+        byPerson.erase(person);
+    }
+}
+
+void RELATIONSHIPINDEX::unlinkTrip(const string &tripID) {
+    auto trip = byTrip.find(tripID);
+    if (trip == byTrip.end()) {
+        return;
+    }
+    if (!trip->second.hostID.empty()) {
+        dropFromPerson(trip->second.hostID, tripID, true);
+    }
+    for (const string &memberID : trip->second.memberIDs) {
+        dropFromPerson(memberID, tripID, false);
+    }
+    byTrip.erase(trip);
+}
+
+void RELATIONSHIPINDEX::unlinkPerson(const string &personID) {
+    auto person = byPerson.find(personID);
+    if (person == byPerson.end()) {
+        return;
+    }
+    for (const string &tripID : person->second.hostedTripIDs) {
+        auto trip = byTrip.find(tripID);
+        if (trip != byTrip.end() && trip->second.hostID == personID) {
+            trip->second.hostID.clear();
+        }
+    }
+    for (const string &tripID : person->second.joinedTripIDs) {
+        auto trip = byTrip.find(tripID);
+        if (trip != byTrip.end()) {
+            eraseValue(trip->second.memberIDs, personID);
+        }
+    }
+    byPerson.erase(person);
+}
+
+// FUNC: Re-key one person; only the trips that list them are visited
+void RELATIONSHIPINDEX::renamePerson(const string &oldID, const string &newID) {
+    auto person = byPerson.find(oldID);
+    if (person == byPerson.end() || oldID == newID) {
+        return;
+    }
+    PERSONLINKS links = move(person->second);
+    byPerson.erase(person);
+
+    for (const string &tripID : links.hostedTripIDs) {
+        auto trip = byTrip.find(tripID);
+        if (trip != byTrip.end() && trip->second.hostID == oldID) {
+            trip->second.hostID = newID;
+        }
+    }
+    for (const string &tripID : links.joinedTripIDs) {
+        auto trip = byTrip.find(tripID);
+        if (trip != byTrip.end()) {
+            replace(trip->second.memberIDs.begin(), trip->second.memberIDs.end(), oldID, newID);
+        }
+    }
+
+    PERSONLINKS &merged = byPerson[newID];
+    merged.hostedTripIDs.insert(merged.hostedTripIDs.end(), links.hostedTripIDs.begin(), links.hostedTripIDs.end());
+    merged.joinedTripIDs.insert(merged.joinedTripIDs.end(), links.joinedTripIDs.begin(), links.joinedTripIDs.end());
+}
+
+void RELATIONSHIPINDEX::clear() {
+    byTrip.clear();
+    byPerson.clear();
+}
+
+const TRIPLINKS &RELATIONSHIPINDEX::getPeopleOfTrip(const string &tripID) const {
+    auto trip = byTrip.find(tripID);
+    return trip != byTrip.end() ? trip->second : noPeople;
+}
+
+const PERSONLINKS &RELATIONSHIPINDEX::getTripsOfPerson(const string &personID) const {
+    auto person = byPerson.find(personID);
+    return person != byPerson.end() ? person->second : noTrips;
+}
+
+size_t RELATIONSHIPINDEX::getLinkedPersonCount() const { return byPerson.size(); }
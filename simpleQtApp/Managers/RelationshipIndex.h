@@ -0,0 +1,49 @@
+#ifndef RELATIONSHIPINDEX_H
+#define RELATIONSHIPINDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+// Who is on a trip, by ID
+struct TRIPLINKS {
+    string hostID;
+    vector<string> memberIDs;
+};
+
+// Which trips a person is on, by ID
+struct PERSONLINKS {
+    vector<string> hostedTripIDs;
+    vector<string> joinedTripIDs;
+
+    bool empty() const { return hostedTripIDs.empty() && joinedTripIDs.empty(); }
+};
+
+// CLASS: RELATIONSHIPINDEX - trip <-> person adjacency lists, kept by TRIPMANAGER
+// This, not MEMBER::joinedTripID / HOST::hostedTripID on the copies inside trips, is the
+// authoritative answer to "who is on this trip" and "which trips is this person on". Every
+// update touches only the lists of the trips and people involved.
+class RELATIONSHIPINDEX {
+   private:
+    unordered_map<string, TRIPLINKS> byTrip;
+    unordered_map<string, PERSONLINKS> byPerson;
+
+    void dropFromPerson(const string &personID, const string &tripID, bool hosted);
+
+   public:
+    void linkTrip(const TRIP &trip);        // Host and members the trip carries
+    void unlinkTrip(const string &tripID);  // Forgets the trip on every person it listed
+    void unlinkPerson(const string &personID);
+    void renamePerson(const string &oldID, const string &newID);
+    void clear();
+
+    const TRIPLINKS &getPeopleOfTrip(const string &tripID) const;  // Empty when unknown
+    const PERSONLINKS &getTripsOfPerson(const string &personID) const;
+    size_t getLinkedPersonCount() const;
+};
+
+#endif  // RELATIONSHIPINDEX_H
@@ -0,0 +1,540 @@
+#include "SnapshotFile.h"
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include "Logger.h"
+#include "ParallelFor.h"
+
+using namespace std;
+
+namespace {
+
+// CLASS: STRINGTABLE - dictionary encoding used while writing a snapshot
+class STRINGTABLE {
+   private:
+    unordered_map<string, quint32> ids;
+    vector<string> strings;
+    size_t totalBytes = 0;
+
+   public:
+    quint32 intern(const string &value) {
+        auto it = ids.find(value);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        quint32 id = static_cast<quint32>(strings.size());
+        ids.emplace(value, id);
+        strings.push_back(value);
+        totalBytes += value.size();
+        return id;
+    }
+
+    quint32 internOptional(const string &value) { return value.empty() ? SNAPSHOT_NO_STRING : intern(value); }
+
+    size_t size() const { return strings.size(); }
+    size_t bytes() const { return totalBytes; }
+    const vector<string> &values() const { return strings; }
+};
+
+quint64 fnv1a(const char *data, size_t size) {
+    quint64 hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+quint32 packDate(const DATE &date) {
+    return (static_cast<quint32>(date.getYear()) << 9) | (static_cast<quint32>(date.getMonth()) << 5) |
+           static_cast<quint32>(date.getDay());
+}
+
+DATE unpackDate(quint32 packed) { return DATE(packed & 0x1F, (packed >> 5) & 0x0F, static_cast<int>(packed >> 9)); }
+
+bool sourceStamp(const QString &csvPath, qint64 &size, qint64 &modified) {
+    QFileInfo info(csvPath);
+    if (!info.exists()) {
+        return false;
+    }
+    size = info.size();
+    modified = info.lastModified().toMSecsSinceEpoch();
+    return true;
+}
+
+// Last write/load statistics per kind; loads happen on the startup worker
+mutex statsLock;
+SNAPSHOTSTATS lastWrite[3];
+SNAPSHOTSTATS lastLoad[3];
+
+void recordStats(SNAPSHOTSTATS *table, SNAPSHOTKIND kind, const SNAPSHOTSTATS &stats, const char *action,
+                 const QString &path) {
+    {
+        lock_guard<mutex> guard(statsLock);
+        table[static_cast<quint32>(kind)] = stats;
+    }
+    LOG_INFO("Snapshot", action, path, "-", stats.rawBytes, "B raw,", stats.storedBytes, "B on disk (ratio",
+             stats.compressionRatio(), "x),", stats.elapsedMs, "ms,", stats.throughputMBps(), "MB/s,", stats.threads,
+             "thread(s)");
+}
+
+// FUNC: Cut the payload into blocks and qCompress each one independently
+QByteArray compressPayload(const string &payload, int &threadsUsed) {
+    size_t blockCount = (payload.size() + SNAPSHOT_BLOCK_SIZE - 1) / SNAPSHOT_BLOCK_SIZE;
+    vector<QByteArray> blocks(blockCount);
+    threadsUsed = parallelFor(blockCount, [&](size_t i) {
+        size_t offset = i * SNAPSHOT_BLOCK_SIZE;
+        size_t length = min<size_t>(SNAPSHOT_BLOCK_SIZE, payload.size() - offset);
+        blocks[i] = qCompress(reinterpret_cast<const uchar *>(payload.data() + offset), static_cast<int>(length));
+    });
+
+    QByteArray out;
+    quint32 prefix[2] = {static_cast<quint32>(blockCount), 0};
+    out.append(reinterpret_cast<const char *>(prefix), sizeof(prefix));
+    for (size_t i = 0; i < blockCount; ++i) {
+        SNAPSHOTBLOCK block;
+        block.rawSize = static_cast<quint32>(min<size_t>(SNAPSHOT_BLOCK_SIZE, payload.size() - i * SNAPSHOT_BLOCK_SIZE));
+        block.compressedSize = static_cast<quint32>(blocks[i].size());
+        out.append(reinterpret_cast<const char *>(&block), sizeof(block));
+    }
+    for (const QByteArray &block : blocks) {
+        out.append(block);
+    }
+    return out;
+}
+
+template <typename T>
+void appendRaw(string &payload, const T *data, size_t count) {
+    payload.append(reinterpret_cast<const char *>(data), count * sizeof(T));
+}
+
+// FUNC: Assemble payload + header and replace the snapshot atomically
+bool writeSnapshot(SNAPSHOTKIND kind, const QString &csvPath, const string &records, quint32 recordCount,
+                   const vector<quint32> &index, const STRINGTABLE &table, bool compressed) {
+    QElapsedTimer timer;
+    timer.start();
+
+    SNAPSHOTHEADER header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "TMSS", 4);
+    header.version = SNAPSHOT_VERSION;
+    header.kind = static_cast<quint32>(kind);
+    if (!sourceStamp(csvPath, header.sourceSize, header.sourceModified)) {
+        return false;
+    }
+
+    // String table: offsets first, then the blob
+    vector<quint32> offsets;
+    offsets.reserve(table.size() + 1);
+    string blob;
+    blob.reserve(table.bytes());
+    for (const string &value : table.values()) {
+        offsets.push_back(static_cast<quint32>(blob.size()));
+        blob += value;
+    }
+    offsets.push_back(static_cast<quint32>(blob.size()));
+
+    string payload;
+    payload.reserve(records.size() + index.size() * sizeof(quint32) + offsets.size() * sizeof(quint32) + blob.size());
+    payload += records;
+    appendRaw(payload, index.data(), index.size());
+    appendRaw(payload, offsets.data(), offsets.size());
+    payload += blob;
+
+    header.recordCount = recordCount;
+    header.indexCount = static_cast<quint32>(index.size());
+    header.stringCount = static_cast<quint32>(table.size());
+    header.stringBytes = static_cast<quint32>(blob.size());
+    header.payloadSize = payload.size();
+    header.checksum = fnv1a(payload.data(), payload.size());
+
+    SNAPSHOTSTATS stats;
+    stats.compressed = compressed;
+    stats.rawBytes = sizeof(header) + payload.size();
+
+    QByteArray packed;
+    if (compressed) {
+        header.flags |= SNAPSHOT_FLAG_COMPRESSED;
+        packed = compressPayload(payload, stats.threads);
+    }
+
+    QSaveFile file(snapshotPathFor(csvPath));
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOG_ERROR("Cannot write snapshot:", snapshotPathFor(csvPath));
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    if (compressed) {
+        file.write(packed);
+    } else {
+        file.write(payload.data(), static_cast<qint64>(payload.size()));
+    }
+    if (!file.commit()) {
+        return false;
+    }
+
+    stats.storedBytes = sizeof(header) + (compressed ? static_cast<quint64>(packed.size()) : payload.size());
+    stats.elapsedMs = timer.elapsed();
+    recordStats(lastWrite, kind, stats, "written", snapshotPathFor(csvPath));
+    return true;
+}
+
+// CLASS: MAPPEDSNAPSHOT - a validated, memory-mapped snapshot file
+class MAPPEDSNAPSHOT {
+   private:
+    QFile file;
+    uchar *base = nullptr;
+    string inflated;  // Uncompressed payload of a compressed snapshot
+
+    // FUNC: Validate the block table and inflate every block into place, in parallel
+    bool inflate(const char *data, quint64 size) {
+        quint32 prefix[2];
+        if (size < sizeof(prefix)) {
+            return false;
+        }
+        memcpy(prefix, data, sizeof(prefix));
+        quint64 blockCount = prefix[0];
+        quint64 tableBytes = sizeof(prefix) + blockCount * sizeof(SNAPSHOTBLOCK);
+        if (tableBytes > size) {
+            return false;
+        }
+
+        vector<SNAPSHOTBLOCK> blocks(blockCount);
+        vector<quint64> rawOffsets(blockCount), packedOffsets(blockCount);
+        memcpy(blocks.data(), data + sizeof(prefix), blockCount * sizeof(SNAPSHOTBLOCK));
+        quint64 rawTotal = 0, packedTotal = tableBytes;
+        for (quint64 i = 0; i < blockCount; ++i) {
+            rawOffsets[i] = rawTotal;
+            packedOffsets[i] = packedTotal;
+            rawTotal += blocks[i].rawSize;
+            packedTotal += blocks[i].compressedSize;
+        }
+        if (rawTotal != header->payloadSize || packedTotal != size) {
+            return false;
+        }
+
+        inflated.assign(rawTotal, '\0');
+        atomic<bool> ok(true);
+        threadsUsed = parallelFor(blockCount, [&](size_t i) {
+            QByteArray raw = qUncompress(reinterpret_cast<const uchar *>(data + packedOffsets[i]),
+                                         static_cast<int>(blocks[i].compressedSize));
+            if (static_cast<quint64>(raw.size()) != blocks[i].rawSize) {
+                ok = false;
+                return;
+            }
+            memcpy(&inflated[rawOffsets[i]], raw.constData(), raw.size());
+        });
+        return ok;
+    }
+
+   public:
+    const SNAPSHOTHEADER *header = nullptr;
+    const char *records = nullptr;
+    const quint32 *index = nullptr;
+    vector<string> strings;
+    int threadsUsed = 1;
+    qint64 fileBytes = 0;
+
+    explicit MAPPEDSNAPSHOT(const QString &path) : file(path) {}
+    ~MAPPEDSNAPSHOT() {
+        if (base) {
+            file.unmap(base);
+        }
+    }
+
+    bool open(const QString &csvPath, SNAPSHOTKIND kind, size_t recordSize) {
+        if (!file.exists() || !file.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+
+        qint64 fileSize = file.size();
+        fileBytes = fileSize;
+        if (fileSize < static_cast<qint64>(sizeof(SNAPSHOTHEADER))) {
+            return false;
+        }
+
+        // One mapping for the whole file
+        base = file.map(0, fileSize);
+        if (!base) {
+            return false;
+        }
+
+        header = reinterpret_cast<const SNAPSHOTHEADER *>(base);
+        if (memcmp(header->magic, "TMSS", 4) != 0 || header->version != SNAPSHOT_VERSION ||
+            header->kind != static_cast<quint32>(kind)) {
+            return false;
+        }
+
+        // Stale if the CSV changed since the snapshot was taken
+        qint64 sourceSize = 0, sourceModified = 0;
+        if (!sourceStamp(csvPath, sourceSize, sourceModified) || sourceSize != header->sourceSize ||
+            sourceModified != header->sourceModified) {
+            LOG_WARNING("Snapshot is stale, falling back to CSV:", csvPath);
+            return false;
+        }
+
+        quint64 expected = static_cast<quint64>(header->recordCount) * recordSize +
+                           static_cast<quint64>(header->indexCount) * sizeof(quint32) +
+                           (static_cast<quint64>(header->stringCount) + 1) * sizeof(quint32) + header->stringBytes;
+        const char *payload = reinterpret_cast<const char *>(base) + sizeof(SNAPSHOTHEADER);
+        quint64 storedPayload = static_cast<quint64>(fileSize) - sizeof(SNAPSHOTHEADER);
+        bool layoutOk = false;
+        if (header->flags & SNAPSHOT_FLAG_COMPRESSED) {
+            layoutOk = header->payloadSize == expected && inflate(payload, storedPayload);
+            payload = inflated.data();
+        } else {
+            layoutOk = storedPayload == header->payloadSize;
+        }
+        if (!layoutOk || header->payloadSize != expected || fnv1a(payload, header->payloadSize) != header->checksum) {
+            LOG_WARNING("Snapshot failed validation, falling back to CSV:", file.fileName());
+            return false;
+        }
+
+        records = payload;
+        index = reinterpret_cast<const quint32 *>(records + header->recordCount * recordSize);
+        const quint32 *offsets = index + header->indexCount;
+        const char *blob = reinterpret_cast<const char *>(offsets + header->stringCount + 1);
+
+        strings.clear();
+        strings.reserve(header->stringCount);
+        for (quint32 i = 0; i < header->stringCount; ++i) {
+            if (offsets[i] > offsets[i + 1] || offsets[i + 1] > header->stringBytes) {
+                return false;
+            }
+            strings.emplace_back(blob + offsets[i], offsets[i + 1] - offsets[i]);
+        }
+        return true;
+    }
+
+    bool validString(quint32 id) const { return id == SNAPSHOT_NO_STRING || id < strings.size(); }
+    const string &stringAt(quint32 id) const {
+        static const string empty;
+        return (id == SNAPSHOT_NO_STRING) ? empty : strings[id];
+    }
+    bool validRange(quint32 begin, quint32 count) const {
+        return static_cast<quint64>(begin) + count <= header->indexCount;
+    }
+};
+
+void recordLoad(SNAPSHOTKIND kind, const MAPPEDSNAPSHOT &snapshot, qint64 elapsedMs, const QString &path) {
+    SNAPSHOTSTATS stats;
+    stats.compressed = (snapshot.header->flags & SNAPSHOT_FLAG_COMPRESSED) != 0;
+    stats.rawBytes = sizeof(SNAPSHOTHEADER) + snapshot.header->payloadSize;
+    stats.storedBytes = static_cast<quint64>(snapshot.fileBytes);
+    stats.elapsedMs = elapsedMs;
+    stats.threads = snapshot.threadsUsed;
+    recordStats(lastLoad, kind, stats, "loaded", path);
+}
+
+}  // namespace
+
+// FUNC: cache.csv -> cache.bin, people_cache.csv -> people_cache.bin
+QString snapshotPathFor(const QString &csvPath) {
+    QString path = csvPath;
+    if (path.endsWith(".csv")) {
+        path.chop(4);
+    }
+    return path + ".bin";
+}
+
+// FUNC: Write trips (with attendee IDs) next to their CSV
+bool writeTripSnapshot(const vector<TRIP> &trips, const QString &csvPath, bool compressed) {
+    STRINGTABLE table;
+    vector<quint32> index;
+    string records;
+    records.reserve(trips.size() * sizeof(TRIPRECORD));
+
+    for (const TRIP &trip : trips) {
+        TRIPRECORD record;
+        memset(&record, 0, sizeof(record));
+        record.id = table.intern(trip.getID());
+        record.destination = table.intern(trip.getDestination());
+        record.description = table.intern(trip.getDescription());
+        record.startDate = packDate(trip.getStartDate());
+        record.endDate = packDate(trip.getEndDate());
+        record.hostID = trip.hasHost() ? table.intern(trip.getHost().getID()) : SNAPSHOT_NO_STRING;
+        record.status = static_cast<quint8>(trip.getStatus());
+
+        vector<MEMBER> members = trip.getMembers();
+        record.memberBegin = static_cast<quint32>(index.size());
+        record.memberCount = static_cast<quint32>(members.size());
+        for (const MEMBER &member : members) {
+            index.push_back(table.intern(member.getID()));
+        }
+
+        appendRaw(records, &record, 1);
+    }
+
+    return writeSnapshot(SNAPSHOTKIND::Trips, csvPath, records, static_cast<quint32>(trips.size()), index, table,
+                         compressed);
+}
+
+// FUNC: Load trips from a valid snapshot; returns false when the CSV must be used instead
+bool loadTripSnapshot(const QString &csvPath, vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) {
+    QElapsedTimer timer;
+    timer.start();
+    MAPPEDSNAPSHOT snapshot(snapshotPathFor(csvPath));
+    if (!snapshot.open(csvPath, SNAPSHOTKIND::Trips, sizeof(TRIPRECORD))) {
+        return false;
+    }
+
+    vector<TRIP> loadedTrips;
+    vector<TRIPATTENDEEIDS> loadedAttendees;
+    loadedTrips.reserve(snapshot.header->recordCount);
+    loadedAttendees.reserve(snapshot.header->recordCount);
+
+    for (quint32 i = 0; i < snapshot.header->recordCount; ++i) {
+        TRIPRECORD record;
+        memcpy(&record, snapshot.records + i * sizeof(TRIPRECORD), sizeof(record));
+
+        if (!snapshot.validString(record.id) || !snapshot.validString(record.destination) ||
+            !snapshot.validString(record.description) || !snapshot.validString(record.hostID) ||
+            !snapshot.validRange(record.memberBegin, record.memberCount) || record.status > 3) {
+            return false;
+        }
+
+        loadedTrips.emplace_back(snapshot.stringAt(record.id), snapshot.stringAt(record.destination),
+                                 snapshot.stringAt(record.description), unpackDate(record.startDate),
+                                 unpackDate(record.endDate), static_cast<STATUS>(record.status));
+
+        TRIPATTENDEEIDS ids;
+        ids.hostID = snapshot.stringAt(record.hostID);
+        ids.memberIDs.reserve(record.memberCount);
+        for (quint32 m = 0; m < record.memberCount; ++m) {
+            quint32 memberString = snapshot.index[record.memberBegin + m];
+            if (!snapshot.validString(memberString)) {
+                return false;
+            }
+            ids.memberIDs.push_back(snapshot.stringAt(memberString));
+        }
+        loadedAttendees.push_back(move(ids));
+    }
+
+    trips = move(loadedTrips);
+    attendees = move(loadedAttendees);
+    recordLoad(SNAPSHOTKIND::Trips, snapshot, timer.elapsed(), snapshotPathFor(csvPath));
+    return true;
+}
+
+// FUNC: Write members and hosts next to their CSV
+bool writePeopleSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts, const QString &csvPath,
+                         bool compressed) {
+    STRINGTABLE table;
+    vector<quint32> index;
+    string records;
+    records.reserve((members.size() + hosts.size()) * sizeof(PERSONRECORD));
+
+    auto fillCommon = [&table](PERSONRECORD &record, const PERSON &person, const string &emergencyContact) {
+        memset(&record, 0, sizeof(record));
+        record.id = table.intern(person.getID());
+        record.fullName = table.intern(person.getFullName());
+        record.email = table.internOptional(person.getEmail());
+        record.phone = table.internOptional(person.getPhoneNumber());
+        record.address = table.internOptional(person.getAddress());
+        record.emergencyContact = table.internOptional(emergencyContact);
+        record.dateOfBirth = packDate(person.getDateOfBirth());
+        record.gender = static_cast<quint8>(person.getGender());
+    };
+
+    for (const MEMBER &member : members) {
+        PERSONRECORD record;
+        fillCommon(record, member, member.getEmergencyContact());
+        record.role = 0;
+        record.totalSpent = member.getTotalSpent();
+
+        vector<string> interests = member.getInterests();
+        record.interestBegin = static_cast<quint32>(index.size());
+        record.interestCount = static_cast<quint32>(interests.size());
+        for (const string &interest : interests) {
+            index.push_back(table.intern(interest));
+        }
+        appendRaw(records, &record, 1);
+    }
+
+    for (const HOST &host : hosts) {
+        PERSONRECORD record;
+        fillCommon(record, host, host.getEmergencyContact());
+        record.role = 1;
+        appendRaw(records, &record, 1);
+    }
+
+    return writeSnapshot(SNAPSHOTKIND::People, csvPath, records, static_cast<quint32>(members.size() + hosts.size()),
+                         index, table, compressed);
+}
+
+// FUNC: Load members and hosts from a valid snapshot; returns false when the CSV must be used instead
+bool loadPeopleSnapshot(const QString &csvPath, vector<MEMBER> &members, vector<HOST> &hosts) {
+    QElapsedTimer timer;
+    timer.start();
+    MAPPEDSNAPSHOT snapshot(snapshotPathFor(csvPath));
+    if (!snapshot.open(csvPath, SNAPSHOTKIND::People, sizeof(PERSONRECORD))) {
+        return false;
+    }
+
+    vector<MEMBER> loadedMembers;
+    vector<HOST> loadedHosts;
+
+    for (quint32 i = 0; i < snapshot.header->recordCount; ++i) {
+        PERSONRECORD record;
+        memcpy(&record, snapshot.records + i * sizeof(PERSONRECORD), sizeof(record));
+
+        if (!snapshot.validString(record.id) || !snapshot.validString(record.fullName) ||
+            !snapshot.validString(record.email) || !snapshot.validString(record.phone) ||
+            !snapshot.validString(record.address) || !snapshot.validString(record.emergencyContact) ||
+            !snapshot.validRange(record.interestBegin, record.interestCount) || record.role > 1) {
+            return false;
+        }
+
+        GENDER gender = static_cast<GENDER>(record.gender);
+        DATE dob = unpackDate(record.dateOfBirth);
+
+        if (record.role == 0) {
+            MEMBER member(snapshot.stringAt(record.id), snapshot.stringAt(record.fullName), gender, dob);
+            member.setEmail(snapshot.stringAt(record.email));
+            member.setPhoneNumber(snapshot.stringAt(record.phone));
+            member.setAddress(snapshot.stringAt(record.address));
+            member.setEmergencyContact(snapshot.stringAt(record.emergencyContact));
+            member.addToTotalSpent(record.totalSpent);
+            for (quint32 k = 0; k < record.interestCount; ++k) {
+                quint32 interest = snapshot.index[record.interestBegin + k];
+                if (!snapshot.validString(interest)) {
+                    return false;
+                }
+                member.addInterest(snapshot.stringAt(interest));
+            }
+            loadedMembers.push_back(move(member));
+        } else {
+            HOST host(snapshot.stringAt(record.id), snapshot.stringAt(record.fullName), gender, dob);
+            host.setEmail(snapshot.stringAt(record.email));
+            host.setPhoneNumber(snapshot.stringAt(record.phone));
+            host.setAddress(snapshot.stringAt(record.address));
+            host.setEmergencyContact(snapshot.stringAt(record.emergencyContact));
+            loadedHosts.push_back(move(host));
+        }
+    }
+
+    members = move(loadedMembers);
+    hosts = move(loadedHosts);
+    recordLoad(SNAPSHOTKIND::People, snapshot, timer.elapsed(), snapshotPathFor(csvPath));
+    return true;
+}
+
+SNAPSHOTSTATS getLastSnapshotWrite(SNAPSHOTKIND kind) {
+    lock_guard<mutex> guard(statsLock);
+    return lastWrite[static_cast<quint32>(kind)];
+}
+
+SNAPSHOTSTATS getLastSnapshotLoad(SNAPSHOTKIND kind) {
+    lock_guard<mutex> guard(statsLock);
+    return lastLoad[static_cast<quint32>(kind)];
+}
@@ -0,0 +1,121 @@
+#ifndef SNAPSHOTFILE_H
+#define SNAPSHOTFILE_H
+
+#include <QString>
+#include <QtGlobal>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+// Binary snapshot of cache.csv / people_cache.csv.
+//
+// Layout (native endianness, every section 4-byte aligned):
+//   SNAPSHOTHEADER
+//   records      recordCount x TRIPRECORD or PERSONRECORD (fixed width)
+//   index        indexCount x quint32 string ids (trip attendees / member interests)
+//   string table (stringCount + 1) x quint32 offsets, then the UTF-8 blob
+// Every string (IDs, destinations, names...) is stored once and referenced by id.
+// The header records the size and mtime of the CSV it was written from; a snapshot
+// that does not match its CSV is stale and the CSV is parsed instead.
+//
+// Compressed snapshots (SNAPSHOT_FLAG_COMPRESSED) keep the same header, followed by
+//   quint32 blockCount, quint32 reserved
+//   blockCount x SNAPSHOTBLOCK
+//   the blocks, each qCompress'ed on its own
+// The payload is cut into SNAPSHOT_BLOCK_SIZE pieces so blocks inflate in parallel;
+// payloadSize and checksum always describe the uncompressed payload.
+
+static const quint32 SNAPSHOT_VERSION = 1;
+static const quint32 SNAPSHOT_NO_STRING = 0xFFFFFFFFu;
+static const quint32 SNAPSHOT_FLAG_COMPRESSED = 0x1u;
+static const quint32 SNAPSHOT_BLOCK_SIZE = 256 * 1024;
+
+enum class SNAPSHOTKIND : quint32 { Trips = 1, People = 2 };
+
+struct SNAPSHOTHEADER {
+    char magic[4];  // "TMSS"
+    quint32 version;
+    quint32 kind;
+    quint32 flags;
+    qint64 sourceSize;
+    qint64 sourceModified;  // msecs since epoch
+    quint32 recordCount;
+    quint32 indexCount;
+    quint32 stringCount;
+    quint32 stringBytes;
+    quint64 payloadSize;
+    quint64 checksum;  // FNV-1a over the payload
+};
+
+struct TRIPRECORD {
+    quint32 id;
+    quint32 destination;
+    quint32 description;
+    quint32 startDate;  // packed: year << 9 | month << 5 | day
+    quint32 endDate;
+    quint32 hostID;
+    quint32 memberBegin;  // range in the index section
+    quint32 memberCount;
+    quint8 status;
+    quint8 reserved[3];
+};
+
+struct PERSONRECORD {
+    double totalSpent;
+    quint32 id;
+    quint32 fullName;
+    quint32 email;
+    quint32 phone;
+    quint32 address;
+    quint32 emergencyContact;
+    quint32 dateOfBirth;     // packed like trip dates
+    quint32 interestBegin;   // range in the index section
+    quint32 interestCount;
+    quint8 role;  // 0 = Member, 1 = Host
+    quint8 gender;
+    quint8 reserved[2];
+};
+
+struct SNAPSHOTBLOCK {
+    quint32 rawSize;
+    quint32 compressedSize;
+};
+
+static_assert(sizeof(SNAPSHOTHEADER) == 64, "snapshot header must stay fixed width");
+static_assert(sizeof(TRIPRECORD) == 36, "trip record must stay fixed width");
+static_assert(sizeof(PERSONRECORD) == 48, "person record must stay fixed width");
+
+// Attendee IDs of a snapshot trip, resolved against the loaded people afterwards
+struct TRIPATTENDEEIDS {
+    string hostID;
+    vector<string> memberIDs;
+};
+
+// Size and timing of the last snapshot written or loaded, per kind
+struct SNAPSHOTSTATS {
+    bool compressed = false;
+    quint64 rawBytes = 0;     // Header + uncompressed payload
+    quint64 storedBytes = 0;  // Size on disk
+    qint64 elapsedMs = 0;     // Write, or map + inflate + validate + decode
+    int threads = 1;
+
+    double compressionRatio() const { return storedBytes ? static_cast<double>(rawBytes) / storedBytes : 1.0; }
+    double throughputMBps() const { return elapsedMs > 0 ? rawBytes / 1048576.0 / (elapsedMs / 1000.0) : 0.0; }
+};
+
+QString snapshotPathFor(const QString &csvPath);
+
+bool writeTripSnapshot(const vector<TRIP> &trips, const QString &csvPath, bool compressed = false);
+bool loadTripSnapshot(const QString &csvPath, vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees);
+
+bool writePeopleSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts, const QString &csvPath,
+                         bool compressed = false);
+bool loadPeopleSnapshot(const QString &csvPath, vector<MEMBER> &members, vector<HOST> &hosts);
+
+SNAPSHOTSTATS getLastSnapshotWrite(SNAPSHOTKIND kind);
+SNAPSHOTSTATS getLastSnapshotLoad(SNAPSHOTKIND kind);
+
+#endif  // SNAPSHOTFILE_H
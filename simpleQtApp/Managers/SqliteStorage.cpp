@@ -0,0 +1,603 @@
+#include "SqliteStorage.h"
+
+#include <QDir>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QStringList>
+#include <QVariant>
+#include <atomic>
+#include <unordered_map>
+
+#include "FileManager.h"
+#include "Logger.h"
+
+using namespace std;
+
+static DATE dateFromKey(int key) { return DATE(key % 100, (key / 100) % 100, key / 10000); }
+
+static QString joinInterests(const vector<string> &interests) {
+    QStringList parts;
+    for (const string &interest : interests) {
+        parts << QString::fromStdString(interest);
+    }
+    return parts.join(';');
+}
+
+// Statements prepared once per transaction (or single-row call) and rebound for every row
+struct TRIPSTATEMENTS {
+    QSqlQuery insertTrip;
+    QSqlQuery clearMembers;
+    QSqlQuery insertMember;
+    QSqlQuery removeTrip;
+
+    explicit TRIPSTATEMENTS(QSqlDatabase &db) : insertTrip(db), clearMembers(db), insertMember(db), removeTrip(db) {
+        insertTrip.prepare(
+            "INSERT OR REPLACE INTO trips (id, destination, description, start_date, end_date, status, host_id) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?)");
+        clearMembers.prepare("DELETE FROM trip_attendees WHERE trip_id = ?");
+        insertMember.prepare("INSERT OR IGNORE INTO trip_attendees (trip_id, member_id, position) VALUES (?, ?, ?)");
+        removeTrip.prepare("DELETE FROM trips WHERE id = ?");
+    }
+};
+
+struct PERSONSTATEMENTS {
+    QSqlQuery upsertPerson;
+    QSqlQuery removePerson;
+
+    explicit PERSONSTATEMENTS(QSqlDatabase &db) : upsertPerson(db), removePerson(db) {
+        upsertPerson.prepare(
+            "INSERT OR REPLACE INTO people (id, role, full_name, email, phone, address, gender, dob, "
+            "emergency_contact, interests, total_spent) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+        removePerson.prepare("DELETE FROM people WHERE id = ?");
+    }
+};
+
+// FUNC: One trip row plus its attendee rows
+static bool writeTrip(TRIPSTATEMENTS &sql, const TRIP &trip) {
+    QString tripID = QString::fromStdString(trip.getID());
+    sql.insertTrip.bindValue(0, tripID);
+    sql.insertTrip.bindValue(1, QString::fromStdString(trip.getDestination()));
+    sql.insertTrip.bindValue(2, QString::fromStdString(trip.getDescription()));
+    sql.insertTrip.bindValue(3, trip.getStartDate().toKey());
+    sql.insertTrip.bindValue(4, trip.getEndDate().toKey());
+    sql.insertTrip.bindValue(5, static_cast<int>(trip.getStatus()));
+    sql.insertTrip.bindValue(6, trip.hasHost() ? QString::fromStdString(trip.getHost().getID()) : QString());
+    if (!sql.insertTrip.exec()) {
+        LOG_ERROR("SQLite: cannot save trip", tripID, sql.insertTrip.lastError().text());
+        return false;
+    }
+
+    sql.clearMembers.bindValue(0, tripID);
+    if (!sql.clearMembers.exec()) {
+        LOG_ERROR("SQLite: cannot clear attendees of", tripID, sql.clearMembers.lastError().text());
+        return false;
+    }
+
+    int position = 0;
+    for (const MEMBER &member : trip.getMembers()) {
+        sql.insertMember.bindValue(0, tripID);
+        sql.insertMember.bindValue(1, QString::fromStdString(member.getID()));
+        sql.insertMember.bindValue(2, position++);
+        if (!sql.insertMember.exec()) {
+            LOG_ERROR("SQLite: cannot save attendees of", tripID, sql.insertMember.lastError().text());
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool deleteTrip(TRIPSTATEMENTS &sql, const string &tripID) {
+    sql.removeTrip.bindValue(0, QString::fromStdString(tripID));
+    return sql.removeTrip.exec();
+}
+
+static bool writePerson(PERSONSTATEMENTS &sql, const PERSON &person, int role, const string &emergencyContact,
+                        const QString &interests, double totalSpent) {
+    QSqlQuery &query = sql.upsertPerson;
+    query.bindValue(0, QString::fromStdString(person.getID()));
+    query.bindValue(1, role);
+    query.bindValue(2, QString::fromStdString(person.getFullName()));
+    query.bindValue(3, QString::fromStdString(person.getEmail()));
+    query.bindValue(4, QString::fromStdString(person.getPhoneNumber()));
+    query.bindValue(5, QString::fromStdString(person.getAddress()));
+    query.bindValue(6, static_cast<int>(person.getGender()));
+    query.bindValue(7, person.getDateOfBirth().toKey());
+    query.bindValue(8, QString::fromStdString(emergencyContact));
+    query.bindValue(9, interests);
+    query.bindValue(10, totalSpent);
+    if (!query.exec()) {
+        LOG_ERROR("SQLite: cannot save person", person.getID(), query.lastError().text());
+        return false;
+    }
+    return true;
+}
+
+static bool writeMember(PERSONSTATEMENTS &sql, const MEMBER &member) {
+    return writePerson(sql, member, 0, member.getEmergencyContact(), joinInterests(member.getInterests()),
+                       member.getTotalSpent());
+}
+
+static bool writeHost(PERSONSTATEMENTS &sql, const HOST &host) {
+    return writePerson(sql, host, 1, host.getEmergencyContact(), QString(), 0.0);
+}
+
+static bool deletePerson(PERSONSTATEMENTS &sql, const string &personID) {
+    sql.removePerson.bindValue(0, QString::fromStdString(personID));
+    return sql.removePerson.exec();
+}
+
+// FUNC: Constructor / Destructor
+SQLITESTORAGE::SQLITESTORAGE(const QString &databasePath) : databasePath(databasePath) {
+    static atomic<int> connectionCounter(0);
+    connectionName = QString("trip_storage_%1").arg(connectionCounter++);
+}
+
+SQLITESTORAGE::~SQLITESTORAGE() { close(); }
+
+QString SQLITESTORAGE::defaultDatabasePath() {
+    QDir currentDir = QDir::current();
+    // Go up one level from simpleQtApp directory to project root
+    currentDir.cdUp();
+    return currentDir.absoluteFilePath("trips.db");
+}
+
+// FUNC: Open the database, switch to WAL and make sure the schema exists
+bool SQLITESTORAGE::open() {
+    if (isOpen()) {
+        return true;
+    }
+
+    db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    db.setDatabaseName(databasePath);
+    if (!db.open()) {
+        LOG_ERROR("SQLite: cannot open", databasePath, "-", db.lastError().text());
+        return false;
+    }
+
+    exec("PRAGMA journal_mode=WAL");
+    exec("PRAGMA synchronous=NORMAL");
+    exec("PRAGMA foreign_keys=ON");
+    return createSchema();
+}
+
+void SQLITESTORAGE::close() {
+    if (db.isValid()) {
+        db.close();
+        db = QSqlDatabase();
+        QSqlDatabase::removeDatabase(connectionName);
+    }
+}
+
+bool SQLITESTORAGE::isOpen() const { return db.isValid() && db.isOpen(); }
+
+bool SQLITESTORAGE::exec(const QString &statement) {
+    QSqlQuery query(db);
+    if (!query.exec(statement)) {
+        LOG_ERROR("SQLite error:", query.lastError().text(), "in", statement);
+        return false;
+    }
+    return true;
+}
+
+bool SQLITESTORAGE::createSchema() {
+    return exec("CREATE TABLE IF NOT EXISTS trips ("
+                "id TEXT PRIMARY KEY, destination TEXT NOT NULL, description TEXT, "
+                "start_date INTEGER NOT NULL, end_date INTEGER NOT NULL, status INTEGER NOT NULL, host_id TEXT)") &&
+           exec("CREATE TABLE IF NOT EXISTS people ("
+                "id TEXT PRIMARY KEY, role INTEGER NOT NULL, full_name TEXT NOT NULL, email TEXT, phone TEXT, "
+                "address TEXT, gender INTEGER, dob INTEGER, emergency_contact TEXT, interests TEXT, "
+                "total_spent REAL DEFAULT 0)") &&
+           exec("CREATE TABLE IF NOT EXISTS trip_attendees ("
+                "trip_id TEXT NOT NULL REFERENCES trips(id) ON DELETE CASCADE, member_id TEXT NOT NULL, "
+                "position INTEGER NOT NULL, PRIMARY KEY (trip_id, member_id))") &&
+           exec("CREATE INDEX IF NOT EXISTS idx_trips_destination ON trips(destination)") &&
+           exec("CREATE INDEX IF NOT EXISTS idx_trips_status ON trips(status)") &&
+           exec("CREATE INDEX IF NOT EXISTS idx_trips_start_date ON trips(start_date)") &&
+           exec("CREATE INDEX IF NOT EXISTS idx_attendees_member ON trip_attendees(member_id)") &&
+           exec("CREATE TABLE IF NOT EXISTS meta (key TEXT PRIMARY KEY, value TEXT)") &&
+           // Databases written before the seeded flag existed were seeded if they hold rows
+           exec("INSERT OR IGNORE INTO meta (key, value) "
+                "SELECT 'seeded_trips', '1' WHERE EXISTS (SELECT 1 FROM trips)") &&
+           exec("INSERT OR IGNORE INTO meta (key, value) "
+                "SELECT 'seeded_people', '1' WHERE EXISTS (SELECT 1 FROM people)");
+}
+
+// FUNC: Seeded flags - one meta row per table
+bool SQLITESTORAGE::isSeeded(const QString &table) {
+    if (!open()) {
+        return false;
+    }
+    QSqlQuery query(db);
+    query.prepare("SELECT 1 FROM meta WHERE key = ?");
+    query.addBindValue("seeded_" + table);
+    return query.exec() && query.next();
+}
+
+bool SQLITESTORAGE::markSeeded(const QString &table) {
+    QSqlQuery query(db);
+    query.prepare("INSERT OR REPLACE INTO meta (key, value) VALUES (?, '1')");
+    query.addBindValue("seeded_" + table);
+    if (!query.exec()) {
+        LOG_ERROR("SQLite: cannot mark", table, "seeded -", query.lastError().text());
+        return false;
+    }
+    return true;
+}
+
+// FUNC: Trips
+bool SQLITESTORAGE::loadTrips(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) {
+    if (!open()) {
+        return false;
+    }
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    if (!query.exec("SELECT id, destination, description, start_date, end_date, status, host_id FROM trips "
+                    "ORDER BY rowid")) {
+        return false;
+    }
+
+    unordered_map<string, size_t> positions;
+    while (query.next()) {
+        string id = query.value(0).toString().toStdString();
+        trips.emplace_back(id, query.value(1).toString().toStdString(), query.value(2).toString().toStdString(),
+                           dateFromKey(query.value(3).toInt()), dateFromKey(query.value(4).toInt()),
+                           static_cast<STATUS>(query.value(5).toInt()));
+        TRIPATTENDEEIDS ids;
+        ids.hostID = query.value(6).toString().toStdString();
+        attendees.push_back(ids);
+        positions.emplace(id, trips.size() - 1);
+    }
+
+    QSqlQuery members(db);
+    members.setForwardOnly(true);
+    if (!members.exec("SELECT trip_id, member_id FROM trip_attendees ORDER BY trip_id, position")) {
+        return false;
+    }
+    while (members.next()) {
+        auto it = positions.find(members.value(0).toString().toStdString());
+        if (it != positions.end()) {
+            attendees[it->second].memberIDs.push_back(members.value(1).toString().toStdString());
+        }
+    }
+    return true;
+}
+
+bool SQLITESTORAGE::saveTrips(const vector<TRIP> &trips) {
+    if (!open() || !db.transaction()) {
+        return false;
+    }
+
+    if (!exec("DELETE FROM trip_attendees") || !exec("DELETE FROM trips")) {
+        db.rollback();
+        return false;
+    }
+
+    TRIPSTATEMENTS sql(db);
+    for (const TRIP &trip : trips) {
+        if (!writeTrip(sql, trip)) {
+            db.rollback();
+            return false;
+        }
+    }
+    if (!markSeeded("trips")) {
+        db.rollback();
+        return false;
+    }
+    return db.commit();
+}
+
+bool SQLITESTORAGE::upsertTrip(const TRIP &trip) {
+    if (!open()) {
+        return false;
+    }
+    TRIPSTATEMENTS sql(db);
+    return writeTrip(sql, trip);
+}
+
+bool SQLITESTORAGE::removeTrip(const string &tripID) {
+    if (!open()) {
+        return false;
+    }
+
+    TRIPSTATEMENTS sql(db);
+    return deleteTrip(sql, tripID);
+}
+
+bool SQLITESTORAGE::applyTripDelta(const TRIPDELTA &delta) {
+    if (!open() || !db.transaction()) {
+        return false;
+    }
+
+    TRIPSTATEMENTS sql(db);
+    for (const string &tripID : delta.removedIDs) {
+        if (!deleteTrip(sql, tripID)) {
+            db.rollback();
+            return false;
+        }
+    }
+    for (const TRIP &trip : delta.upserted) {
+        if (!writeTrip(sql, trip)) {
+            db.rollback();
+            return false;
+        }
+    }
+    return db.commit();
+}
+
+size_t SQLITESTORAGE::tripCount() {
+    if (!open()) {
+        return 0;
+    }
+    QSqlQuery query(db);
+    if (!query.exec("SELECT COUNT(*) FROM trips") || !query.next()) {
+        return 0;
+    }
+    return static_cast<size_t>(query.value(0).toLongLong());
+}
+
+// FUNC: Translate the filter criteria into one indexed SELECT
+vector<string> SQLITESTORAGE::queryTripIDs(const TRIPQUERY &criteria) {
+    vector<string> ids;
+    if (!open()) {
+        return ids;
+    }
+
+    QStringList where;
+    QVariantList binds;
+
+    if (!criteria.destinationEquals.empty()) {
+        where << "destination = ?";
+        binds << QString::fromStdString(criteria.destinationEquals);
+    }
+
+    QStringList statusSlots;
+    for (STATUS status : criteria.statuses) {
+        statusSlots << "?";
+        binds << static_cast<int>(status);
+    }
+    where << (statusSlots.isEmpty() ? QString("0") : "status IN (" + statusSlots.join(", ") + ")");
+
+    if (!criteria.descriptionKeywords.empty()) {
+        QStringList anyKeyword;
+        for (const string &keyword : criteria.descriptionKeywords) {
+            anyKeyword << "instr(description, ?) > 0";
+            binds << QString::fromStdString(keyword);
+        }
+        where << "(" + anyKeyword.join(" OR ") + ")";
+    }
+
+    if (criteria.dateFilter) {
+        where << "start_date BETWEEN ? AND ?"
+              << "end_date BETWEEN ? AND ?";
+        binds << criteria.startFrom << criteria.startTo << criteria.endFrom << criteria.endTo;
+    }
+
+    static const char *orderColumns[] = {
+        "start_date",
+        "end_date",
+        "destination",
+        "id",
+        "CASE status WHEN 3 THEN 0 WHEN 2 THEN 1 WHEN 1 THEN 2 ELSE 3 END",  // Alphabetical like the status names
+        "length(CAST(description AS BLOB))"};  // Bytes, like std::string::length()
+    int sortBy = (criteria.sortBy >= 0 && criteria.sortBy < 6) ? criteria.sortBy : 0;
+
+    QString statement = "SELECT id FROM trips WHERE " + where.join(" AND ") + " ORDER BY " +
+                        orderColumns[sortBy] + (criteria.ascending ? " ASC" : " DESC") + ", rowid";
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    query.prepare(statement);
+    for (const QVariant &value : binds) {
+        query.addBindValue(value);
+    }
+    if (!query.exec()) {
+        LOG_ERROR("SQLite filter failed:", query.lastError().text());
+        return ids;
+    }
+
+    while (query.next()) {
+        ids.push_back(query.value(0).toString().toStdString());
+    }
+    return ids;
+}
+
+// FUNC: People
+bool SQLITESTORAGE::loadPeople(vector<MEMBER> &members, vector<HOST> &hosts) {
+    if (!open()) {
+        return false;
+    }
+
+    QSqlQuery query(db);
+    query.setForwardOnly(true);
+    if (!query.exec("SELECT id, role, full_name, email, phone, address, gender, dob, emergency_contact, interests, "
+                    "total_spent FROM people ORDER BY rowid")) {
+        return false;
+    }
+
+    while (query.next()) {
+        string id = query.value(0).toString().toStdString();
+        string fullName = query.value(2).toString().toStdString();
+        GENDER gender = static_cast<GENDER>(query.value(6).toInt());
+        DATE dob = dateFromKey(query.value(7).toInt());
+
+        if (query.value(1).toInt() == 0) {
+            MEMBER member(id, fullName, gender, dob);
+            member.setEmail(query.value(3).toString().toStdString());
+            member.setPhoneNumber(query.value(4).toString().toStdString());
+            member.setAddress(query.value(5).toString().toStdString());
+            member.setEmergencyContact(query.value(8).toString().toStdString());
+            for (const QString &interest : query.value(9).toString().split(';', Qt::SkipEmptyParts)) {
+                member.addInterest(interest.toStdString());
+            }
+            member.addToTotalSpent(query.value(10).toDouble());
+            members.push_back(member);
+        } else {
+            HOST host(id, fullName, gender, dob);
+            host.setEmail(query.value(3).toString().toStdString());
+            host.setPhoneNumber(query.value(4).toString().toStdString());
+            host.setAddress(query.value(5).toString().toStdString());
+            host.setEmergencyContact(query.value(8).toString().toStdString());
+            hosts.push_back(host);
+        }
+    }
+    return true;
+}
+
+bool SQLITESTORAGE::savePeople(const vector<MEMBER> &members, const vector<HOST> &hosts) {
+    if (!open() || !db.transaction()) {
+        return false;
+    }
+
+    if (!exec("DELETE FROM people")) {
+        db.rollback();
+        return false;
+    }
+
+    PERSONSTATEMENTS sql(db);
+    for (const MEMBER &member : members) {
+        if (!writeMember(sql, member)) {
+            db.rollback();
+            return false;
+        }
+    }
+    for (const HOST &host : hosts) {
+        if (!writeHost(sql, host)) {
+            db.rollback();
+            return false;
+        }
+    }
+    if (!markSeeded("people")) {
+        db.rollback();
+        return false;
+    }
+    return db.commit();
+}
+
+bool SQLITESTORAGE::upsertMember(const MEMBER &member) {
+    if (!open()) {
+        return false;
+    }
+    PERSONSTATEMENTS sql(db);
+    return writeMember(sql, member);
+}
+
+bool SQLITESTORAGE::upsertHost(const HOST &host) {
+    if (!open()) {
+        return false;
+    }
+    PERSONSTATEMENTS sql(db);
+    return writeHost(sql, host);
+}
+
+bool SQLITESTORAGE::removePerson(const string &personID) {
+    if (!open()) {
+        return false;
+    }
+
+    PERSONSTATEMENTS sql(db);
+    return deletePerson(sql, personID);
+}
+
+bool SQLITESTORAGE::applyPersonDelta(const PERSONDELTA &delta) {
+    if (!open() || !db.transaction()) {
+        return false;
+    }
+
+    PERSONSTATEMENTS sql(db);
+    bool ok = true;
+    for (const string &personID : delta.removedIDs) {
+        ok = ok && deletePerson(sql, personID);
+    }
+    for (const MEMBER &member : delta.upsertedMembers) {
+        ok = ok && writeMember(sql, member);
+    }
+    for (const HOST &host : delta.upsertedHosts) {
+        ok = ok && writeHost(sql, host);
+    }
+
+    if (!ok) {
+        db.rollback();
+        return false;
+    }
+    return db.commit();
+}
+
+size_t SQLITESTORAGE::personCount() {
+    if (!open()) {
+        return 0;
+    }
+    QSqlQuery query(db);
+    if (!query.exec("SELECT COUNT(*) FROM people") || !query.next()) {
+        return 0;
+    }
+    return static_cast<size_t>(query.value(0).toLongLong());
+}
+
+bool SQLITESTORAGE::checkpoint() { return open() && exec("PRAGMA wal_checkpoint(TRUNCATE)"); }
+
+// ========================================
+// STORE INTERFACES
+// ========================================
+
+SQLITETRIPSTORE::SQLITETRIPSTORE(const QString &databasePath) : storage(databasePath) {}
+
+string SQLITETRIPSTORE::getName() const { return "sqlite"; }
+
+bool SQLITETRIPSTORE::load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) {
+    if (storage.isSeeded("trips")) {
+        return storage.loadTrips(trips, attendees);  // Empty is a valid state once seeded
+    }
+
+    // Never seeded: start from the cache files, the next save fills SQLite
+    trips.clear();
+    attendees.clear();
+    return BINARYTRIPSTORE(getCacheFilePath()).load(trips, attendees);
+}
+
+bool SQLITETRIPSTORE::saveSnapshot(const vector<TRIP> &trips) { return storage.saveTrips(trips); }
+
+bool SQLITETRIPSTORE::applyDelta(const TRIPDELTA &delta, const TRIPSNAPSHOT &current) {
+    // A database still waiting to be seeded gets the full state once, even an empty one
+    if (!storage.isSeeded("trips")) {
+        return saveSnapshot(current.toVector());
+    }
+    return storage.applyTripDelta(delta);
+}
+
+bool SQLITETRIPSTORE::flush() { return storage.checkpoint(); }
+
+bool SQLITETRIPSTORE::canQuery(size_t loadedTripCount, bool hasUnsavedChanges) {
+    return !hasUnsavedChanges && storage.tripCount() == loadedTripCount;
+}
+
+vector<string> SQLITETRIPSTORE::queryTripIDs(const TRIPQUERY &query) { return storage.queryTripIDs(query); }
+
+SQLITEPERSONSTORE::SQLITEPERSONSTORE(const QString &databasePath) : storage(databasePath) {}
+
+string SQLITEPERSONSTORE::getName() const { return "sqlite"; }
+
+bool SQLITEPERSONSTORE::load(vector<MEMBER> &members, vector<HOST> &hosts) {
+    if (storage.isSeeded("people")) {
+        return storage.loadPeople(members, hosts);
+    }
+
+    members.clear();
+    hosts.clear();
+    return BINARYPERSONSTORE(getPeopleCacheFilePath()).load(members, hosts);
+}
+
+bool SQLITEPERSONSTORE::saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) {
+    return storage.savePeople(members, hosts);
+}
+
+bool SQLITEPERSONSTORE::applyDelta(const PERSONDELTA &delta, const vector<MEMBER> &members,
+                                   const vector<HOST> &hosts) {
+    // A database still waiting to be seeded gets the full state once, even an empty one
+    if (!storage.isSeeded("people")) {
+        return saveSnapshot(members, hosts);
+    }
+    return storage.applyPersonDelta(delta);
+}
+
+bool SQLITEPERSONSTORE::flush() { return storage.checkpoint(); }
@@ -0,0 +1,94 @@
+#ifndef SQLITESTORAGE_H
+#define SQLITESTORAGE_H
+
+#include <QSqlDatabase>
+#include <QString>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "DataStore.h"
+#include "SnapshotFile.h"
+
+using namespace std;
+
+// CLASS: SQLITESTORAGE - optional storage backend on Qt's bundled SQLite driver
+// Every instance owns its own connection, so create one per thread.
+class SQLITESTORAGE {
+   private:
+    QString databasePath;
+    QString connectionName;
+    QSqlDatabase db;
+
+    bool exec(const QString &statement);
+    bool createSchema();
+    bool markSeeded(const QString &table);  // Inside the transaction that filled the table
+
+   public:
+    explicit SQLITESTORAGE(const QString &databasePath);
+    ~SQLITESTORAGE();
+
+    bool open();
+    void close();
+    bool isOpen() const;
+
+    static QString defaultDatabasePath();
+
+    // True once a full save has filled the table, even with zero rows; until then it is not authoritative
+    bool isSeeded(const QString &table);
+
+    // FUNC: Trips
+    bool loadTrips(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees);
+    bool saveTrips(const vector<TRIP> &trips);  // Full replace in one transaction
+    bool upsertTrip(const TRIP &trip);
+    bool removeTrip(const string &tripID);
+    bool applyTripDelta(const TRIPDELTA &delta);  // One transaction
+    size_t tripCount();
+    vector<string> queryTripIDs(const TRIPQUERY &query);
+
+    // FUNC: People
+    bool loadPeople(vector<MEMBER> &members, vector<HOST> &hosts);
+    bool savePeople(const vector<MEMBER> &members, const vector<HOST> &hosts);  // Full replace in one transaction
+    bool upsertMember(const MEMBER &member);
+    bool upsertHost(const HOST &host);
+    bool removePerson(const string &personID);
+    bool applyPersonDelta(const PERSONDELTA &delta);  // One transaction
+    size_t personCount();
+
+    bool checkpoint();  // Fold the WAL back into the database file
+};
+
+// CLASS: SQLITETRIPSTORE / SQLITEPERSONSTORE - store interfaces over trips.db
+// Deltas touch only the changed rows. A table that was never seeded is loaded from the binary cache
+// once and written in full by the next save; after that SQLite is the only source, even when empty.
+class SQLITETRIPSTORE : public TRIPSTORE {
+   private:
+    SQLITESTORAGE storage;
+
+   public:
+    explicit SQLITETRIPSTORE(const QString &databasePath);
+
+    string getName() const override;
+    bool load(vector<TRIP> &trips, vector<TRIPATTENDEEIDS> &attendees) override;
+    bool saveSnapshot(const vector<TRIP> &trips) override;
+    bool applyDelta(const TRIPDELTA &delta, const TRIPSNAPSHOT &current) override;
+    bool flush() override;
+    bool canQuery(size_t loadedTripCount, bool hasUnsavedChanges) override;
+    vector<string> queryTripIDs(const TRIPQUERY &query) override;
+};
+
+class SQLITEPERSONSTORE : public PERSONSTORE {
+   private:
+    SQLITESTORAGE storage;
+
+   public:
+    explicit SQLITEPERSONSTORE(const QString &databasePath);
+
+    string getName() const override;
+    bool load(vector<MEMBER> &members, vector<HOST> &hosts) override;
+    bool saveSnapshot(const vector<MEMBER> &members, const vector<HOST> &hosts) override;
+    bool applyDelta(const PERSONDELTA &delta, const vector<MEMBER> &members, const vector<HOST> &hosts) override;
+    bool flush() override;
+};
+
+#endif  // SQLITESTORAGE_H
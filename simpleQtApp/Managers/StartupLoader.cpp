@@ -0,0 +1,97 @@
+#include "StartupLoader.h"
+
+#include <QElapsedTimer>
+#include <QString>
+#include <memory>
+#include <unordered_map>
+
+#include "Logger.h"
+
+using namespace std;
+
+// FUNC: Constructor
+STARTUPLOADER::STARTUPLOADER(STORAGEBACKEND backend, size_t batchSize)
+    : backend(backend), batchSize(batchSize), cancelled(false) {}
+
+void STARTUPLOADER::cancel() { cancelled = true; }
+
+bool STARTUPLOADER::isCancelled() const { return cancelled; }
+
+STARTUPTIMINGS STARTUPLOADER::getTimings() const { return timings; }
+
+// FUNC: Load people first (trips need them for attendees), then hand trips out in batches
+void STARTUPLOADER::run(const PeopleCallback &onPeopleLoaded, const TripBatchCallback &onTripBatch) {
+    QElapsedTimer phaseTimer;
+
+    // Phase 1: people
+    phaseTimer.start();
+    vector<MEMBER> members;
+    vector<HOST> hosts;
+    unique_ptr<PERSONSTORE> personStore = createPersonStore(backend);
+    if (personStore->load(members, hosts)) {
+        LOG_INFO("Startup: people loaded from", personStore->getName(), "store");
+    }
+
+    // Lookups for attendee restoration, built before the vectors are handed over
+    unordered_map<string, MEMBER> memberLookup;
+    unordered_map<string, HOST> hostLookup;
+    memberLookup.reserve(members.size());
+    hostLookup.reserve(hosts.size());
+    for (const MEMBER &member : members) {
+        memberLookup.emplace(member.getID(), member);
+    }
+    for (const HOST &host : hosts) {
+        hostLookup.emplace(host.getID(), host);
+    }
+
+    timings.peopleLoadMs = phaseTimer.restart();
+    onPeopleLoaded(move(members), move(hosts));
+
+    if (cancelled) {
+        return;
+    }
+
+    // Phase 2: trips, attached to their attendees and handed out in batches
+    vector<TRIP> trips;
+    vector<TRIPATTENDEEIDS> attendees;
+    unique_ptr<TRIPSTORE> tripStore = createTripStore(backend);
+    if (!tripStore->load(trips, attendees)) {
+        timings.tripParseMs = phaseTimer.elapsed();
+        return;
+    }
+    LOG_INFO("Startup:", trips.size(), "trips loaded from", tripStore->getName(), "store");
+
+    vector<TRIP> batch;
+    batch.reserve(batchSize);
+
+    for (size_t i = 0; i < trips.size() && !cancelled; ++i) {
+        TRIP &trip = trips[i];
+        const TRIPATTENDEEIDS &ids = attendees[i];
+
+        if (!ids.hostID.empty()) {
+            auto hostIt = hostLookup.find(ids.hostID);
+            if (hostIt != hostLookup.end()) {
+                trip.setHost(hostIt->second);
+            }
+        }
+        for (const string &memberID : ids.memberIDs) {
+            auto memberIt = memberLookup.find(memberID);
+            if (memberIt != memberLookup.end()) {
+                trip.addMember(memberIt->second);
+            }
+        }
+
+        batch.push_back(move(trip));
+        if (batch.size() >= batchSize) {
+            onTripBatch(move(batch), static_cast<int>((i + 1) * 100 / trips.size()));
+            batch = vector<TRIP>();
+            batch.reserve(batchSize);
+        }
+    }
+
+    if (!batch.empty() && !cancelled) {
+        onTripBatch(move(batch), 100);
+    }
+
+    timings.tripParseMs = phaseTimer.elapsed();
+}
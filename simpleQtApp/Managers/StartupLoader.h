@@ -0,0 +1,48 @@
+#ifndef STARTUPLOADER_H
+#define STARTUPLOADER_H
+
+#include <QtGlobal>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+#include "DataStore.h"
+
+using namespace std;
+
+// Time spent in each startup phase, in milliseconds
+struct STARTUPTIMINGS {
+    qint64 peopleLoadMs = 0;
+    qint64 tripParseMs = 0;
+    qint64 applyMs = 0;
+    qint64 totalMs = 0;
+};
+
+// CLASS: STARTUPLOADER - reads the people and trip caches off the UI thread
+// The loader never touches the managers; results are handed out through the callbacks
+// so the caller decides on which thread they get applied.
+class STARTUPLOADER {
+   public:
+    using PeopleCallback = function<void(vector<MEMBER> &&members, vector<HOST> &&hosts)>;
+    using TripBatchCallback = function<void(vector<TRIP> &&batch, int percentDone)>;
+
+   private:
+    STORAGEBACKEND backend;
+    size_t batchSize;
+    atomic<bool> cancelled;
+    STARTUPTIMINGS timings;
+
+   public:
+    explicit STARTUPLOADER(STORAGEBACKEND backend, size_t batchSize = 500);
+
+    // Runs on the worker thread (the stores are opened there too)
+    void run(const PeopleCallback &onPeopleLoaded, const TripBatchCallback &onTripBatch);
+
+    void cancel();
+    bool isCancelled() const;
+    STARTUPTIMINGS getTimings() const;
+};
+
+#endif  // STARTUPLOADER_H
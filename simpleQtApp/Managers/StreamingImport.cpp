@@ -0,0 +1,122 @@
+#include "StreamingImport.h"
+
+#include <fstream>
+#include <stdexcept>
+
+#include "FileManager.h"
+
+using namespace std;
+
+// FUNC: Shared reader loop - one line and one batch in memory at a time
+// headerMarkers: a first line containing any of them is skipped as the header
+// flush() sees the counters so far through stats
+template <typename PARSELINE, typename FLUSH>
+static void streamLines(const string &filePath, const vector<string> &headerMarkers, size_t batchSize,
+                        IMPORTSTATS &stats, PARSELINE parseLine, FLUSH flush) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        throw runtime_error("Cannot open file: " + filePath);
+    }
+
+    string line;
+    bool firstLine = true;
+    size_t pending = 0;
+
+    while (std::getline(file, line)) {
+        stats.bytesRead += line.size() + 1;
+        if (firstLine) {
+            firstLine = false;
+            bool isHeader = false;
+            for (const string &marker : headerMarkers) {
+                isHeader = isHeader || line.find(marker) != string::npos;
+            }
+            if (isHeader) continue;
+        }
+        if (line.empty()) continue;
+
+        stats.rowsRead++;
+        if (!parseLine(line)) {
+            stats.rowsSkipped++;
+            continue;
+        }
+        stats.recordsParsed++;
+
+        if (++pending >= batchSize) {
+            stats.batches++;
+            pending = 0;
+            if (!flush()) {
+                stats.stopped = true;
+                return;
+            }
+        }
+    }
+
+    if (pending > 0) {
+        stats.batches++;
+        stats.stopped = !flush();
+    }
+}
+
+IMPORTSTATS streamTripImport(const string &filePath, TRIPSINK &sink, size_t batchSize) {
+    if (batchSize == 0) batchSize = DEFAULT_IMPORT_BATCH;
+
+    vector<TRIP> batch;
+    batch.reserve(batchSize);
+    TRIP trip;
+
+    IMPORTSTATS stats;
+    streamLines(
+        filePath, {"ID", "Destination"}, batchSize, stats,
+        [&](const string &line) {
+            if (!parseTripImportLine(line, trip)) return false;
+            batch.push_back(move(trip));
+            return true;
+        },
+        [&]() {
+            bool keepGoing = sink.consume(move(batch));
+            batch = vector<TRIP>();
+            batch.reserve(batchSize);
+            sink.progress(stats);
+            return keepGoing;
+        });
+
+    sink.finish();
+    return stats;
+}
+
+IMPORTSTATS streamPeopleImport(const string &filePath, PERSONSINK &sink, size_t batchSize) {
+    if (batchSize == 0) batchSize = DEFAULT_IMPORT_BATCH;
+
+    vector<MEMBER> members;
+    vector<HOST> hosts;
+
+    IMPORTSTATS stats;
+    streamLines(
+        filePath, {"FullName", "Name"}, batchSize, stats,
+        [&](const string &line) { return parsePersonLine(line, members, hosts); },
+        [&]() {
+            bool keepGoing = sink.consume(move(members), move(hosts));
+            members = vector<MEMBER>();
+            hosts = vector<HOST>();
+            sink.progress(stats);
+            return keepGoing;
+        });
+
+    sink.finish();
+    return stats;
+}
+
+// ========================================
+// SINKS
+// ========================================
+
+bool TRIPCOLLECTORSINK::consume(vector<TRIP> &&batch) {
+    target.insert(target.end(), make_move_iterator(batch.begin()), make_move_iterator(batch.end()));
+    return true;
+}
+
+bool PEOPLECOLLECTORSINK::consume(vector<MEMBER> &&batchMembers, vector<HOST> &&batchHosts) {
+    members.insert(members.end(), make_move_iterator(batchMembers.begin()), make_move_iterator(batchMembers.end()));
+    hosts.insert(hosts.end(), make_move_iterator(batchHosts.begin()), make_move_iterator(batchHosts.end()));
+    return true;
+}
@@ -0,0 +1,72 @@
+#ifndef STREAMINGIMPORT_H
+#define STREAMINGIMPORT_H
+
+#include <QtGlobal>
+#include <string>
+#include <vector>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+static const size_t DEFAULT_IMPORT_BATCH = 1000;
+
+// Counters for one streaming run
+struct IMPORTSTATS {
+    size_t rowsRead = 0;       // Data rows, header excluded
+    size_t recordsParsed = 0;  // Rows that became a record
+    size_t rowsSkipped = 0;    // Malformed rows
+    size_t batches = 0;
+    quint64 bytesRead = 0;     // Including line breaks, for progress against the file size
+    bool stopped = false;      // The sink asked to stop early
+};
+
+// CLASS: TRIPSINK / PERSONSINK - receivers of parsed batches
+// consume() returning false stops the import; the reader never holds more than one batch,
+// so a slow sink slows the reader down instead of letting records pile up.
+class TRIPSINK {
+   public:
+    virtual ~TRIPSINK() = default;
+    virtual bool consume(vector<TRIP> &&batch) = 0;
+    virtual void progress(const IMPORTSTATS &soFar) { (void)soFar; }  // After every batch
+    virtual void finish() {}
+};
+
+class PERSONSINK {
+   public:
+    virtual ~PERSONSINK() = default;
+    virtual bool consume(vector<MEMBER> &&members, vector<HOST> &&hosts) = 0;
+    virtual void progress(const IMPORTSTATS &soFar) { (void)soFar; }
+    virtual void finish() {}
+};
+
+// FUNC: Stream a trip import file (Destination,Description,StartDate,EndDate,Status) or a
+// people file into a sink. Throws runtime_error when the file cannot be opened.
+IMPORTSTATS streamTripImport(const string &filePath, TRIPSINK &sink, size_t batchSize = DEFAULT_IMPORT_BATCH);
+IMPORTSTATS streamPeopleImport(const string &filePath, PERSONSINK &sink, size_t batchSize = DEFAULT_IMPORT_BATCH);
+
+// ========================================
+// SINKS
+// ========================================
+
+// Appends every batch to a vector (what the old importTripInfo returned)
+class TRIPCOLLECTORSINK : public TRIPSINK {
+   private:
+    vector<TRIP> &target;
+
+   public:
+    explicit TRIPCOLLECTORSINK(vector<TRIP> &target) : target(target) {}
+    bool consume(vector<TRIP> &&batch) override;
+};
+
+class PEOPLECOLLECTORSINK : public PERSONSINK {
+   private:
+    vector<MEMBER> &members;
+    vector<HOST> &hosts;
+
+   public:
+    PEOPLECOLLECTORSINK(vector<MEMBER> &members, vector<HOST> &hosts) : members(members), hosts(hosts) {}
+    bool consume(vector<MEMBER> &&batchMembers, vector<HOST> &&batchHosts) override;
+};
+
+#endif  // STREAMINGIMPORT_H
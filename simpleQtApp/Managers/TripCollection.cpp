@@ -0,0 +1,124 @@
+#include "TripCollection.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace std;
+
+namespace {
+
+const shared_ptr<const TRIPCHUNKS> EMPTY_CHUNKS = make_shared<const TRIPCHUNKS>();
+
+// FUNC: True when nobody else holds p. Other threads can only drop references (a snapshot is taken
+// on the mutating thread), so a stale count errs towards an extra copy; the fence orders their
+// last reads before our write.
+template <typename T>
+bool isExclusive(const shared_ptr<T> &p) {
+    if (p.use_count() != 1) {
+        return false;
+    }
+    atomic_thread_fence(memory_order_acquire);
+    return true;
+}
+
+}  // namespace
+
+size_t TRIPCHUNKS::chunkOf(size_t index) const {
+    return static_cast<size_t>(upper_bound(starts.begin(), starts.end(), index) - starts.begin()) - 1;
+}
+
+// ========================================
+// TRIPSNAPSHOT
+// ========================================
+
+TRIPSNAPSHOT::TRIPSNAPSHOT() : root(EMPTY_CHUNKS) {}
+
+TRIPSNAPSHOT::TRIPSNAPSHOT(shared_ptr<const TRIPCHUNKS> root) : root(move(root)) {}
+
+const TRIP &TRIPSNAPSHOT::operator[](size_t index) const {
+    size_t chunk = root->chunkOf(index);
+    return (*root->chunks[chunk])[index - root->starts[chunk]];
+}
+
+vector<TRIP> TRIPSNAPSHOT::toVector() const {
+    vector<TRIP> trips;
+    trips.reserve(size());
+    for (const shared_ptr<vector<TRIP>> &chunk : root->chunks) {
+        trips.insert(trips.end(), chunk->begin(), chunk->end());
+    }
+    return trips;
+}
+
+// ========================================
+// TRIPCOLLECTION
+// ========================================
+
+TRIPCOLLECTION::TRIPCOLLECTION() : root(make_shared<TRIPCHUNKS>()) {}
+
+TRIPCOLLECTION::TRIPCOLLECTION(vector<TRIP> &&trips) : root(make_shared<TRIPCHUNKS>()) {
+    for (TRIP &trip : trips) {
+        push_back(move(trip));
+    }
+    trips.clear();
+}
+
+// FUNC: Copy-on-write - the chunk list first, then the one chunk about to change
+void TRIPCOLLECTION::detachRoot() {
+    if (!isExclusive(root)) {
+        root = make_shared<TRIPCHUNKS>(*root);
+    }
+}
+
+vector<TRIP> &TRIPCOLLECTION::detachChunk(size_t chunk) {
+    shared_ptr<vector<TRIP>> &trips = root->chunks[chunk];
+    if (!isExclusive(trips)) {
+        trips = make_shared<vector<TRIP>>(*trips);
+    }
+    return *trips;
+}
+
+const TRIP &TRIPCOLLECTION::operator[](size_t index) const {
+    size_t chunk = root->chunkOf(index);
+    return (*root->chunks[chunk])[index - root->starts[chunk]];
+}
+
+TRIP &TRIPCOLLECTION::mutableAt(size_t index) {
+    detachRoot();
+    size_t chunk = root->chunkOf(index);
+    return detachChunk(chunk)[index - root->starts[chunk]];
+}
+
+void TRIPCOLLECTION::push_back(const TRIP &trip) { push_back(TRIP(trip)); }
+
+// FUNC: Append to the last chunk while it has room, otherwise open a new one
+void TRIPCOLLECTION::push_back(TRIP &&trip) {
+    detachRoot();
+    if (root->chunks.empty() || root->chunks.back()->size() >= TRIP_CHUNK_CAPACITY) {
+        root->chunks.push_back(make_shared<vector<TRIP>>());
+        root->chunks.back()->reserve(TRIP_CHUNK_CAPACITY);
+        root->starts.push_back(root->count);
+    }
+    detachChunk(root->chunks.size() - 1).push_back(move(trip));
+    ++root->count;
+}
+
+// FUNC: Erase from one chunk; only the starts after it move
+void TRIPCOLLECTION::erase(size_t index) {
+    detachRoot();
+    size_t chunk = root->chunkOf(index);
+    vector<TRIP> &trips = detachChunk(chunk);
+    trips.erase(trips.begin() + (index - root->starts[chunk]));
+
+    if (trips.empty()) {
+        root->chunks.erase(root->chunks.begin() + chunk);
+        root->starts.erase(root->starts.begin() + chunk);
+    } else {
+        ++chunk;
+    }
+    for (size_t i = chunk; i < root->starts.size(); ++i) {
+        --root->starts[i];
+    }
+    --root->count;
+}
+
+TRIPSNAPSHOT TRIPCOLLECTION::snapshot() const { return TRIPSNAPSHOT(root); }
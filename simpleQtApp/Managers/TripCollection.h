@@ -0,0 +1,159 @@
+#ifndef TRIPCOLLECTION_H
+#define TRIPCOLLECTION_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "../Models/header.h"
+
+using namespace std;
+
+static const size_t TRIP_CHUNK_CAPACITY = 64;  // Trips copied by the first write to a shared chunk
+
+// Chunk list shared between a TRIPCOLLECTION and its snapshots. starts[i] is the position of
+// chunks[i]'s first trip; chunks are never empty.
+struct TRIPCHUNKS {
+    vector<shared_ptr<vector<TRIP>>> chunks;
+    vector<size_t> starts;
+    size_t count = 0;
+
+    size_t chunkOf(size_t index) const;  // Binary search over starts
+};
+
+// CLASS: TRIPSNAPSHOTITERATOR - walks the chunks in order; shared by snapshots and the collection
+class TRIPSNAPSHOTITERATOR {
+   private:
+    const TRIPCHUNKS *root;
+    size_t chunk;
+    size_t offset;
+
+   public:
+    using iterator_category = forward_iterator_tag;
+    using value_type = TRIP;
+    using difference_type = ptrdiff_t;
+    using pointer = const TRIP *;
+    using reference = const TRIP &;
+
+    TRIPSNAPSHOTITERATOR(const TRIPCHUNKS *root, size_t chunk) : root(root), chunk(chunk), offset(0) {}
+
+    reference operator*() const { return (*root->chunks[chunk])[offset]; }
+    pointer operator->() const { return &**this; }
+    TRIPSNAPSHOTITERATOR &operator++() {
+        if (++offset == root->chunks[chunk]->size()) {
+            ++chunk;
+            offset = 0;
+        }
+        return *this;
+    }
+    TRIPSNAPSHOTITERATOR operator++(int) {
+        TRIPSNAPSHOTITERATOR before = *this;
+        ++*this;
+        return before;
+    }
+    bool operator==(const TRIPSNAPSHOTITERATOR &rhs) const { return chunk == rhs.chunk && offset == rhs.offset; }
+    bool operator!=(const TRIPSNAPSHOTITERATOR &rhs) const { return !(*this == rhs); }
+};
+
+// CLASS: TRIPSNAPSHOT - immutable view of the trips at the moment it was taken
+// Taking one is O(1): it only shares the collection's chunk list. Later writes to the collection
+// copy the chunks they touch first, so a snapshot can be read on any thread and kept as long as
+// needed (an export, a dialog) while the UI keeps mutating the manager.
+class TRIPSNAPSHOT {
+   private:
+    shared_ptr<const TRIPCHUNKS> root;
+
+   public:
+    using const_iterator = TRIPSNAPSHOTITERATOR;
+
+    TRIPSNAPSHOT();  // Empty
+    explicit TRIPSNAPSHOT(shared_ptr<const TRIPCHUNKS> root);
+
+    size_t size() const { return root->count; }
+    bool empty() const { return root->count == 0; }
+    const TRIP &operator[](size_t index) const;  // O(log chunks)
+    const_iterator begin() const { return const_iterator(root.get(), 0); }
+    const_iterator end() const { return const_iterator(root.get(), root->chunks.size()); }
+
+    vector<TRIP> toVector() const;  // For APIs that need contiguous trips; this one copies
+};
+
+// CLASS: TRIPCOLLECTION - TRIPMANAGER's trip storage, a chunked copy-on-write vector
+// Only one thread mutates a collection. Before a write, the chunk list and the chunk being written
+// are copied if a snapshot still shares them, so a write costs at most one chunk list and one
+// chunk of copying, and snapshots never see it.
+class TRIPCOLLECTION {
+   private:
+    shared_ptr<TRIPCHUNKS> root;
+
+    void detachRoot();
+    vector<TRIP> &detachChunk(size_t chunk);
+
+   public:
+    TRIPCOLLECTION();
+    explicit TRIPCOLLECTION(vector<TRIP> &&trips);
+
+    size_t size() const { return root->count; }
+    bool empty() const { return root->count == 0; }
+    const TRIP &operator[](size_t index) const;
+    TRIPSNAPSHOTITERATOR begin() const { return TRIPSNAPSHOTITERATOR(root.get(), 0); }
+    TRIPSNAPSHOTITERATOR end() const { return TRIPSNAPSHOTITERATOR(root.get(), root->chunks.size()); }
+
+    // Writable trip; valid until the next mutation or snapshot
+    TRIP &mutableAt(size_t index);
+    void push_back(const TRIP &trip);
+    void push_back(TRIP &&trip);
+    void erase(size_t index);
+
+    // One pass; chunks without a removed trip stay shared. Returns how many were removed.
+    template <typename PREDICATE>
+    size_t removeIf(PREDICATE shouldRemove);
+
+    TRIPSNAPSHOT snapshot() const;
+};
+
+template <typename PREDICATE>
+size_t TRIPCOLLECTION::removeIf(PREDICATE shouldRemove) {
+    auto rebuilt = make_shared<TRIPCHUNKS>();
+    size_t removed = 0;
+    for (const shared_ptr<vector<TRIP>> &chunk : root->chunks) {
+        vector<size_t> doomed;  // The predicate runs exactly once per trip
+        for (size_t i = 0; i < chunk->size(); ++i) {
+            if (shouldRemove((*chunk)[i])) {
+                doomed.push_back(i);
+            }
+        }
+        if (doomed.empty()) {
+            rebuilt->chunks.push_back(chunk);
+            continue;
+        }
+
+        removed += doomed.size();
+        if (doomed.size() == chunk->size()) continue;
+
+        auto kept = make_shared<vector<TRIP>>();
+        kept->reserve(chunk->size() - doomed.size());
+        size_t next = 0;
+        for (size_t i = 0; i < chunk->size(); ++i) {
+            if (next < doomed.size() && doomed[next] == i) {
+                ++next;
+            } else {
+                kept->push_back((*chunk)[i]);
+            }
+        }
+        rebuilt->chunks.push_back(kept);
+    }
+
+    if (removed == 0) {
+        return 0;
+    }
+    for (const shared_ptr<vector<TRIP>> &chunk : rebuilt->chunks) {
+        rebuilt->starts.push_back(rebuilt->count);
+        rebuilt->count += chunk->size();
+    }
+    root = rebuilt;
+    return removed;
+}
+
+#endif  // TRIPCOLLECTION_H
@@ -2,6 +2,7 @@
 #define TRIPFACTORY_H
 
 #include "../Models/header.h"
+#include "IdAllocator.h"
 
 using namespace std;
 
@@ -10,10 +11,12 @@ class TRIPFACTORY {
     static int nextTripNumber;
 
    public:
+    // With an allocator the trip gets an ID no other trip holds
     static TRIP createTrip(const string& destination, const string& description, const DATE& startDate,
-                           const DATE& endDate, STATUS status);
+                           const DATE& endDate, STATUS status, IDALLOCATOR* ids = nullptr);
 
-    static string generateTripID(const string& destination, const DATE& startDate);
+    static string generateTripID(const string& destination, const DATE& startDate);  // Base ID, may be taken
+    static string generateTripID(const string& destination, const DATE& startDate, IDALLOCATOR& ids);
 };
 
 #endif  // TRIPFACTORY_H
\ No newline at end of file
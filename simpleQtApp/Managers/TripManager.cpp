@@ -1,45 +1,452 @@
 #include "TripManager.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 using namespace std;
 
 // CLASS: TRIPMANAGER
 
-void TRIPMANAGER::addTrip(const TRIP &trip) {
+// FUNC: Rebuild the ID lookup after positions shift
+void TRIPMANAGER::rebuildTripIndex() {
+    tripIndex.clear();
+    tripIndex.reserve(trips.size());
+    size_t position = 0;
+    for (const TRIP &trip : trips) {
+        tripIndex.emplace(trip.getID(), position++);
+    }
+}
+
+// FUNC: Only the trips after an erased one move, each down by one; a later trip with the
+// removed ID takes its place (first occurrence wins)
+void TRIPMANAGER::unindexTrip(const string &removedID, size_t position) {
+    tripIndex.erase(removedID);
+    for (size_t i = position; i < trips.size(); ++i) {
+        const string &id = trips[i].getID();
+        auto it = tripIndex.find(id);
+        if (it == tripIndex.end()) {
+            tripIndex.emplace(id, i);
+        } else if (it->second == i + 1) {
+            it->second = i;
+        }
+    }
+}
+
+// FUNC: Re-key one renamed trip; positions do not move
+void TRIPMANAGER::reindexTrip(const string &oldID, size_t position) {
+    tripIndex.erase(oldID);
+    for (size_t i = position + 1; i < trips.size(); ++i) {
+        if (trips[i].getID() == oldID) {
+            tripIndex.emplace(oldID, i);
+            break;
+        }
+    }
+    auto it = tripIndex.find(trips[position].getID());
+    if (it == tripIndex.end()) {
+        tripIndex.emplace(trips[position].getID(), position);
+    } else if (it->second > position) {
+        it->second = position;
+    }
+}
+
+// FUNC: Keep the per-status views sorted on every mutation (binary search + insert/erase)
+void TRIPMANAGER::addToStatusView(const TRIP &trip) {
+    vector<STATUSVIEWENTRY> &view = statusViews[static_cast<size_t>(trip.getStatus())];
+    STATUSVIEWENTRY entry{trip.getStartDate().toKey(), trip.getID()};
+    view.insert(upper_bound(view.begin(), view.end(), entry), entry);
+}
+
+void TRIPMANAGER::removeFromStatusView(const TRIP &trip) {
+    vector<STATUSVIEWENTRY> &view = statusViews[static_cast<size_t>(trip.getStatus())];
+    STATUSVIEWENTRY entry{trip.getStartDate().toKey(), trip.getID()};
+    auto it = lower_bound(view.begin(), view.end(), entry);
+    if (it != view.end() && it->tripID == entry.tripID) {
+        view.erase(it);
+    }
+}
+
+// FUNC: Checks for one trip - O(1) index probes plus one lookup per attendee
+vector<VALIDATIONISSUE> TRIPMANAGER::checkTrip(const TRIP &trip, const string &previousID) const {
+    vector<VALIDATIONISSUE> issues;
+    checkTripID(trip, previousID, issues);
+    if (trip.getEndDate() < trip.getStartDate()) {
+        issues.push_back({VALIDATIONCHECK::EndBeforeStart, trip.getID(),
+                          trip.getStartDate().toString() + " - " + trip.getEndDate().toString()});
+    }
+    if (isKnownHost && trip.hasHost() && !isKnownHost(trip.getHost().getID())) {
+        issues.push_back({VALIDATIONCHECK::DanglingHost, trip.getID(), trip.getHost().getID()});
+    }
+    if (isKnownMember) {
+        for (const MEMBER &member : trip.getMembers()) {
+            if (!isKnownMember(member.getID())) {
+                issues.push_back({VALIDATIONCHECK::DanglingMember, trip.getID(), member.getID()});
+            }
+        }
+    }
+    return issues;
+}
+
+void TRIPMANAGER::checkTripID(const TRIP &trip, const string &previousID, vector<VALIDATIONISSUE> &issues) const {
+    if (trip.getID() == previousID) {
+        return;
+    }
+    const TRIP *holder = findTripById(trip.getID());
+    if (holder && isSameTrip(*holder, trip)) {
+        issues.push_back({VALIDATIONCHECK::DuplicateTripID, trip.getID(), "already stored"});
+    } else if (holder) {
+        issues.push_back({VALIDATIONCHECK::TripIDCollision, trip.getID(), "held by " + holder->getDestination()});
+    }
+}
+
+// FUNC: A taken ID is refused in every mode, since the index, the statistics, the status views and
+// the stores all key trips by ID; the other checks follow the integrity mode. The caller has
+// called integrity.begin().
+bool TRIPMANAGER::admitTrip(const TRIP &trip, const string &previousID, const char *operation) {
+    vector<VALIDATIONISSUE> issues;
+    if (integrity.isEnabled()) {
+        issues = checkTrip(trip, previousID);
+    } else {
+        checkTripID(trip, previousID, issues);
+    }
+    bool idTaken = any_of(issues.begin(), issues.end(), [](const VALIDATIONISSUE &issue) {
+        return issue.check == VALIDATIONCHECK::DuplicateTripID || issue.check == VALIDATIONCHECK::TripIDCollision;
+    });
+    bool admitted = idTaken ? integrity.refuse(move(issues)) : integrity.admit(move(issues));
+    integrity.end(operation);
+    return admitted;
+}
+
+bool TRIPMANAGER::addTrip(const TRIP &trip) {
+    integrity.begin();
+    if (!admitTrip(trip, string(), "addTrip")) {
+        return false;
+    }
+
     trips.push_back(trip);
+    tripIndex.emplace(trip.getID(), trips.size() - 1);
+    addToStatusView(trip);
+    relationships.linkTrip(trip);
+    changes.recordAdded(trip.getID(), tripContentHash(trip));
     notifyTripAdded(trip.getID());
+    return true;
+}
+
+// FUNC: Bulk import - rows carry no ID, so a clashing base ID is only a duplicate for the same
+// destination and dates; any other trip takes the next free suffix
+TRIPIMPORTRESULT TRIPMANAGER::importTrips(vector<TRIP> &&batch) {
+    TRIPIMPORTRESULT result;
+    IDALLOCATOR ids = makeIDAllocator();
+    integrity.begin();
+    unordered_map<string, size_t> batchIndex;  // Final ID -> position in fresh
+    vector<TRIP> fresh;
+    fresh.reserve(batch.size());
+
+    for (TRIP &trip : batch) {
+        string id = ids.allocate(trip.getID(), [&](const string &heldID) {
+            const TRIP *holder = findTripById(heldID);
+            if (!holder) {
+                auto it = batchIndex.find(heldID);
+                holder = (it != batchIndex.end()) ? &fresh[it->second] : nullptr;
+            }
+            return holder && isSameTrip(*holder, trip);
+        });
+        if (id.empty()) {
+            result.duplicateIDs.push_back(trip.getID());
+            continue;
+        }
+
+        trip.setID(id);
+        if (integrity.isEnabled() && !integrity.admit(checkTrip(trip))) {
+            result.rejectedIDs.push_back(id);
+            continue;
+        }
+        batchIndex.emplace(id, fresh.size());
+        result.addedIDs.push_back(id);
+        fresh.push_back(move(trip));
+    }
+
+    integrity.end("importTrips");
+    batch.clear();
+    appendTrips(move(fresh), false);  // IDs are allocated unique and the rest is checked above
+    return result;
+}
+
+void TRIPMANAGER::addTrips(vector<TRIP> &&batch) {
+    if (integrity.isEnabled()) {
+        integrity.begin();
+        appendTrips(move(batch), true);
+        integrity.end("addTrips");
+    } else {
+        appendTrips(move(batch), false);
+    }
+}
+
+// FUNC: Bulk append - views are merged once per batch instead of one sorted insert per trip
+// Each trip is checked before it is indexed, so clashes inside the batch are found as well.
+void TRIPMANAGER::appendTrips(vector<TRIP> &&batch, bool checkEach) {
+    if (batch.empty()) {
+        return;
+    }
+
+    vector<STATUSVIEWENTRY> newEntries[4];
+    vector<string> addedIDs;
+    addedIDs.reserve(batch.size());
+
+    for (TRIP &trip : batch) {
+        const string id = trip.getID();
+        if (checkEach) {
+            integrity.admit(checkTrip(trip), false);
+        }
+        newEntries[static_cast<size_t>(trip.getStatus())].push_back({trip.getStartDate().toKey(), id});
+        changes.recordAdded(id, tripContentHash(trip));
+        relationships.linkTrip(trip);
+        trips.push_back(move(trip));
+        tripIndex.emplace(id, trips.size() - 1);
+        addedIDs.push_back(id);
+    }
+
+    for (size_t status = 0; status < 4; ++status) {
+        vector<STATUSVIEWENTRY> &view = statusViews[status];
+        vector<STATUSVIEWENTRY> &entries = newEntries[status];
+        if (entries.empty()) continue;
+
+        sort(entries.begin(), entries.end());
+        size_t middle = view.size();
+        view.insert(view.end(), entries.begin(), entries.end());
+        inplace_merge(view.begin(), view.begin() + middle, view.end());
+    }
+
+    batch.clear();
+    notifyTripsAdded(addedIDs);
 }
 
 bool TRIPMANAGER::removeTrip(const string &tripID) {
-    for (size_t i = 0; i < trips.size(); ++i) {
-        if (trips[i].getID() == tripID) {
-            trips.erase(trips.begin() + i);
-            notifyTripRemoved(tripID);
-            return true;
+    auto it = tripIndex.find(tripID);
+    if (it == tripIndex.end()) {
+        return false;
+    }
+
+    string removedID = tripID;  // tripID may refer to the trip being erased
+    size_t position = it->second;
+    removeFromStatusView(trips[position]);
+    relationships.unlinkTrip(removedID);
+    changes.recordRemoved(removedID, tripContentHash(trips[position]));
+    trips.erase(position);
+    unindexTrip(removedID, position);
+    notifyTripRemoved(removedID);
+    return true;
+}
+
+// FUNC: Bulk remove (import rollback) - one compaction pass instead of an erase per trip
+size_t TRIPMANAGER::removeTrips(const vector<string> &tripIDs) {
+    unordered_set<string> doomed;
+    for (const string &id : tripIDs) {
+        if (tripIndex.count(id)) {
+            doomed.insert(id);
+        }
+    }
+    if (doomed.empty()) {
+        return 0;
+    }
+
+    vector<string> removedIDs;
+    removedIDs.reserve(doomed.size());
+    trips.removeIf([&](const TRIP &trip) {
+        if (!doomed.count(trip.getID())) {
+            return false;
         }
+        changes.recordRemoved(trip.getID(), tripContentHash(trip));
+        removedIDs.push_back(trip.getID());
+        return true;
+    });
+    rebuildTripIndex();
+    for (const string &id : removedIDs) {
+        relationships.unlinkTrip(id);
     }
-    return false;
+
+    for (vector<STATUSVIEWENTRY> &view : statusViews) {
+        view.erase(remove_if(view.begin(), view.end(),
+                             [&](const STATUSVIEWENTRY &entry) { return doomed.count(entry.tripID) != 0; }),
+                   view.end());
+    }
+
+    notifyTripsRemoved(removedIDs);
+    return removedIDs.size();
 }
 
 bool TRIPMANAGER::updateTrip(const TRIP &originalTrip, const TRIP &updatedTrip) {
-    for (size_t i = 0; i < trips.size(); ++i) {
-        if (trips[i].getID() == originalTrip.getID()) {
-            trips[i] = updatedTrip;
-            notifyTripUpdated(updatedTrip.getID());
-            return true;
+    integrity.begin();  // A missing trip must not leave an earlier rejection readable
+    auto it = tripIndex.find(originalTrip.getID());
+    if (it == tripIndex.end()) {
+        return false;
+    }
+    if (!admitTrip(updatedTrip, originalTrip.getID(), "updateTrip")) {
+        return false;
+    }
+
+    string originalID = originalTrip.getID();  // originalTrip may be the trip about to be overwritten
+    quint64 oldHash = tripContentHash(trips[it->second]);
+    removeFromStatusView(trips[it->second]);
+    relationships.unlinkTrip(originalID);
+    trips.mutableAt(it->second) = updatedTrip;
+    addToStatusView(updatedTrip);
+    relationships.linkTrip(updatedTrip);
+
+    if (originalID == updatedTrip.getID()) {
+        changes.recordUpdated(updatedTrip.getID(), oldHash, tripContentHash(updatedTrip));
+        notifyTripUpdated(updatedTrip.getID());
+    } else {
+        // NOTE: A renamed trip is reported as remove + add so observers keyed by ID stay consistent
+        reindexTrip(originalID, it->second);
+        changes.recordRemoved(originalID, oldHash);
+        changes.recordAdded(updatedTrip.getID(), tripContentHash(updatedTrip));
+        notifyTripRemoved(originalID);
+        notifyTripAdded(updatedTrip.getID());
+    }
+    return true;
+}
+
+TRIPSNAPSHOT TRIPMANAGER::getAllTrips() const { return trips.snapshot(); }
+
+const TRIP *TRIPMANAGER::findTripById(const string &id) const {
+    auto it = tripIndex.find(id);
+    return (it != tripIndex.end()) ? &trips[it->second] : nullptr;
+}
+
+size_t TRIPMANAGER::getTripCount() const { return trips.size(); }
+
+// FUNC: Integrity
+void TRIPMANAGER::setPeopleLookup(IDALLOCATOR::IDCHECK isMember, IDALLOCATOR::IDCHECK isHost) {
+    isKnownMember = move(isMember);
+    isKnownHost = move(isHost);
+}
+
+INTEGRITYGUARD &TRIPMANAGER::getIntegrityGuard() { return integrity; }
+
+const INTEGRITYGUARD &TRIPMANAGER::getIntegrityGuard() const { return integrity; }
+
+IDALLOCATOR TRIPMANAGER::makeIDAllocator(const string &keepID) const {
+    return IDALLOCATOR([this, keepID](const string &id) { return id != keepID && tripIndex.count(id) != 0; });
+}
+
+// FUNC: Status views
+size_t TRIPMANAGER::getStatusViewSize(STATUS status) const { return statusViews[static_cast<size_t>(status)].size(); }
+
+// FUNC: Return one page of a status view; cost is proportional to the page, not the collection
+vector<const TRIP *> TRIPMANAGER::getTripsByStatus(STATUS status, size_t offset, size_t limit) const {
+    const vector<STATUSVIEWENTRY> &view = statusViews[static_cast<size_t>(status)];
+    vector<const TRIP *> page;
+    if (offset >= view.size()) {
+        return page;
+    }
+
+    size_t end = min(view.size(), offset + limit);
+    page.reserve(end - offset);
+    for (size_t i = offset; i < end; ++i) {
+        const TRIP *trip = findTripById(view[i].tripID);
+        if (trip) {
+            page.push_back(trip);
+        }
+    }
+    return page;
+}
+
+// FUNC: Relationships
+template <typename EDIT>
+vector<string> TRIPMANAGER::editTrips(const vector<string> &tripIDs, EDIT edit) {
+    vector<string> edited;
+    for (const string &id : tripIDs) {
+        auto it = tripIndex.find(id);
+        if (it == tripIndex.end()) continue;
+
+        TRIP &trip = trips.mutableAt(it->second);
+        quint64 oldHash = tripContentHash(trip);
+        if (edit(trip)) {
+            changes.recordUpdated(id, oldHash, tripContentHash(trip));
+            edited.push_back(id);
         }
     }
-    return false;
+    return edited;
+}
+
+const PERSONLINKS &TRIPMANAGER::getTripsOfPerson(const string &personID) const {
+    return relationships.getTripsOfPerson(personID);
+}
+
+const TRIPLINKS &TRIPMANAGER::getPeopleOfTrip(const string &tripID) const { return relationships.getPeopleOfTrip(tripID); }
+
+// FUNC: Cascade for deleted people - their copies leave the trips, one notification for all of them
+size_t TRIPMANAGER::detachPeople(const vector<string> &personIDs) {
+    vector<string> touched;
+    for (const string &personID : personIDs) {
+        PERSONLINKS links = relationships.getTripsOfPerson(personID);  // Copy: unlinking clears it
+        if (links.empty()) continue;
+
+        vector<string> left = editTrips(links.joinedTripIDs, [&](TRIP &trip) { return trip.removeMember(personID); });
+        vector<string> unhosted = editTrips(links.hostedTripIDs, [&](TRIP &trip) {
+            if (trip.getHost().getID() != personID) return false;
+            trip.clearHost();
+            return true;
+        });
+        relationships.unlinkPerson(personID);
+
+        touched.insert(touched.end(), left.begin(), left.end());
+        touched.insert(touched.end(), unhosted.begin(), unhosted.end());
+    }
+
+    sort(touched.begin(), touched.end());
+    touched.erase(unique(touched.begin(), touched.end()), touched.end());
+    if (!touched.empty()) {
+        notifyTripsUpdated(touched);
+    }
+    return touched.size();
+}
+
+// FUNC: Cascade for edited people - replace the copies inside their trips and re-key the links
+size_t TRIPMANAGER::refreshMember(const string &previousID, const MEMBER &member) {
+    const string oldID = previousID;
+    PERSONLINKS links = relationships.getTripsOfPerson(oldID);
+    vector<string> touched =
+        editTrips(links.joinedTripIDs, [&](TRIP &trip) { return trip.replaceMember(oldID, member); });
+    relationships.renamePerson(oldID, member.getID());
+
+    if (!touched.empty()) {
+        notifyTripsUpdated(touched);
+    }
+    return touched.size();
 }
 
-const vector<TRIP> &TRIPMANAGER::getAllTrips() const { return trips; }
+size_t TRIPMANAGER::refreshHost(const string &previousID, const HOST &host) {
+    const string oldID = previousID;
+    PERSONLINKS links = relationships.getTripsOfPerson(oldID);
+    vector<string> touched = editTrips(links.hostedTripIDs, [&](TRIP &trip) {
+        if (trip.getHost().getID() != oldID) return false;
+        trip.setHost(host);
+        return true;
+    });
+    relationships.renamePerson(oldID, host.getID());
 
-TRIP *TRIPMANAGER::findTripById(const string &id) {
-    for (size_t i = 0; i < trips.size(); ++i) {
-        if (trips[i].getID() == id) {
-            return &trips[i];
+    if (!touched.empty()) {
+        notifyTripsUpdated(touched);
+    }
+    return touched.size();
+}
+
+// FUNC: Dirty tracking
+bool TRIPMANAGER::hasUnsavedChanges() const { return changes.isDirty(); }
+
+TRIPDELTA TRIPMANAGER::getPendingDelta() const {
+    TRIPDELTA delta;
+    delta.removedIDs.assign(changes.getRemovedIDs().begin(), changes.getRemovedIDs().end());
+    for (const string &id : changes.getUpsertedIDs()) {
+        const TRIP *trip = findTripById(id);
+        if (trip) {
+            delta.upserted.push_back(*trip);
         }
     }
-    return nullptr;
+    return delta;
 }
 
-size_t TRIPMANAGER::getTripCount() const { return trips.size(); }
\ No newline at end of file
+void TRIPMANAGER::markSaved() { changes.markSaved(); }
+
+const DIRTYTRACKER &TRIPMANAGER::getChangeTracker() const { return changes; }
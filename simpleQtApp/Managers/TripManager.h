@@ -2,24 +2,99 @@
 #define TRIPMANAGER_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "../Models/header.h"
+#include "DataStore.h"
+#include "DirtyTracker.h"
+#include "IdAllocator.h"
+#include "IntegrityGuard.h"
 #include "Observer.h"
+#include "RelationshipIndex.h"
+#include "TripCollection.h"
 
 using namespace std;
 
+// One row of a materialized status view, ordered by start date then ID
+struct STATUSVIEWENTRY {
+    int startKey;
+    string tripID;
+
+    bool operator<(const STATUSVIEWENTRY &rhs) const {
+        return (startKey != rhs.startKey) ? startKey < rhs.startKey : tripID < rhs.tripID;
+    }
+};
+
+// Outcome of TRIPMANAGER::importTrips
+struct TRIPIMPORTRESULT {
+    vector<string> addedIDs;      // Final IDs, suffixed where the base ID was taken
+    vector<string> duplicateIDs;  // Same destination and dates as a known trip or one earlier in the batch
+    vector<string> rejectedIDs;   // Failed an integrity check in strict mode
+};
+
 class TRIPMANAGER : public SUBJECT {
    private:
-    vector<TRIP> trips;
+    TRIPCOLLECTION trips;                     // Chunked copy-on-write, so snapshots are O(1)
+    unordered_map<string, size_t> tripIndex;  // Trip ID -> position in trips (first occurrence wins)
+    vector<STATUSVIEWENTRY> statusViews[4];   // Sorted trip IDs per STATUS, kept in step with trips
+    DIRTYTRACKER changes;                     // Unsaved mutations since the last store write
+    RELATIONSHIPINDEX relationships;          // Trip <-> person links, kept in step with trips
+    INTEGRITYGUARD integrity;                 // Per-mutation checks and what the last one found
+    IDALLOCATOR::IDCHECK isKnownMember;       // People lookups for reference checks; unset skips them
+    IDALLOCATOR::IDCHECK isKnownHost;
+
+    void rebuildTripIndex();
+    void unindexTrip(const string &removedID, size_t position);  // After trips.erase(position)
+    void reindexTrip(const string &oldID, size_t position);      // The trip at position was renamed
+    void appendTrips(vector<TRIP> &&batch, bool checkEach);
+
+    // Issues the trip would introduce: its ID (unless it keeps previousID), its dates, its references
+    vector<VALIDATIONISSUE> checkTrip(const TRIP &trip, const string &previousID = string()) const;
+    void checkTripID(const TRIP &trip, const string &previousID, vector<VALIDATIONISSUE> &issues) const;
+    bool admitTrip(const TRIP &trip, const string &previousID, const char *operation);
+    void addToStatusView(const TRIP &trip);
+    void removeFromStatusView(const TRIP &trip);
+
+    // Applies edit to each listed trip, recording the ones it changed; status and dates must not change
+    template <typename EDIT>
+    vector<string> editTrips(const vector<string> &tripIDs, EDIT edit);
 
    public:
-    void addTrip(const TRIP &trip);
+    bool addTrip(const TRIP &trip);       // False for a taken ID, or when strict integrity rejects it
+    void addTrips(vector<TRIP> &&batch);  // Bulk append (stored data), one notification; issues are only logged
+    TRIPIMPORTRESULT importTrips(vector<TRIP> &&batch);  // addTrips that skips known trips and re-IDs clashes
     bool removeTrip(const string &tripID);
+    size_t removeTrips(const vector<string> &tripIDs);  // Bulk remove, one notification; returns how many went
     bool updateTrip(const TRIP &originalTrip, const TRIP &updatedTrip);
-    const vector<TRIP> &getAllTrips() const;
-    TRIP *findTripById(const string &id);
+    TRIPSNAPSHOT getAllTrips() const;       // O(1) snapshot; stays unchanged and readable on any thread
+    const TRIP *findTripById(const string &id) const;  // Valid until the next mutation; edit via updateTrip
     size_t getTripCount() const;
+
+    // Incremental integrity: every mutation checks only the trip it touches, in the guard's mode
+    void setPeopleLookup(IDALLOCATOR::IDCHECK isMember, IDALLOCATOR::IDCHECK isHost);
+    INTEGRITYGUARD &getIntegrityGuard();
+    const INTEGRITYGUARD &getIntegrityGuard() const;
+
+    // IDs no other trip holds; keepID is the trip being edited, which may keep its own
+    IDALLOCATOR makeIDAllocator(const string &keepID = string()) const;
+
+    // Materialized status views (ordered by start date)
+    size_t getStatusViewSize(STATUS status) const;
+    vector<const TRIP *> getTripsByStatus(STATUS status, size_t offset, size_t limit) const;
+
+    // Trip <-> person relationships: O(1) lookups, cascades only visit the linked trips
+    const PERSONLINKS &getTripsOfPerson(const string &personID) const;
+    const TRIPLINKS &getPeopleOfTrip(const string &tripID) const;
+    size_t detachPeople(const vector<string> &personIDs);  // Removed people leave every trip they were on
+    size_t refreshMember(const string &previousID, const MEMBER &member);  // Trip copies follow edits and renames
+    size_t refreshHost(const string &previousID, const HOST &host);
+
+    // Dirty tracking for the persistence layer
+    bool hasUnsavedChanges() const;
+    TRIPDELTA getPendingDelta() const;  // Only the trips touched since markSaved()
+    void markSaved();
+    const DIRTYTRACKER &getChangeTracker() const;
 };
 
-#endif  // TRIPMANAGER_H
\ No newline at end of file
+#endif  // TRIPMANAGER_H
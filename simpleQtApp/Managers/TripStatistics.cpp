@@ -0,0 +1,163 @@
+#include "TripStatistics.h"
+
+#include <QDate>
+
+#include "TripManager.h"
+
+using namespace std;
+
+static size_t statusSlot(STATUS status) { return static_cast<size_t>(status); }
+
+static void adjust(size_t &counter, int sign, size_t amount = 1) {
+    if (sign > 0) {
+        counter += amount;
+    } else {
+        counter -= amount;
+    }
+}
+
+static TRIPCONTRIBUTION makeContribution(const TRIP &trip) {
+    TRIPCONTRIBUTION contribution;
+    contribution.status = trip.getStatus();
+    contribution.destination = trip.getDestination();
+    contribution.startKey = trip.getStartDate().toKey();
+    contribution.endKey = trip.getEndDate().toKey();
+    contribution.monthKey = contribution.startKey / 100;
+    contribution.memberCount = trip.getMemberCount();
+    contribution.hasHost = trip.hasHost();
+    return contribution;
+}
+
+// FUNC: Constructor
+TRIPSTATISTICS::TRIPSTATISTICS(const TRIPMANAGER *tripManager)
+    : tripManager(tripManager),
+      statusCounts{0, 0, 0, 0},
+      totalMembers(0),
+      hostedTrips(0),
+      todayKey(currentDateKey()),
+      upcomingCount(0),
+      ongoingCount(0) {
+    // Pick up anything the manager already holds
+    if (tripManager) {
+        for (const TRIP &trip : tripManager->getAllTrips()) {
+            onTripAdded(trip.getID());
+        }
+    }
+}
+
+// FUNC: Date helper
+int TRIPSTATISTICS::currentDateKey() {
+    QDate today = QDate::currentDate();
+    return DATE(today.day(), today.month(), today.year()).toKey();
+}
+
+// FUNC: Add (sign = +1) or retract (sign = -1) one trip from every counter
+void TRIPSTATISTICS::apply(const TRIPCONTRIBUTION &contribution, int sign) {
+    adjust(statusCounts[statusSlot(contribution.status)], sign);
+    adjust(totalMembers, sign, contribution.memberCount);
+    adjust(hostedTrips, sign, contribution.hasHost ? 1 : 0);
+
+    size_t &destinationCount = destinationCounts[contribution.destination];
+    adjust(destinationCount, sign);
+    if (destinationCount == 0) {
+        destinationCounts.erase(contribution.destination);
+    }
+
+    size_t &monthCount = monthCounts[contribution.monthKey];
+    adjust(monthCount, sign);
+    if (monthCount == 0) {
+        monthCounts.erase(contribution.monthKey);
+    }
+
+    applyRelativeToToday(contribution, sign);
+}
+
+void TRIPSTATISTICS::applyRelativeToToday(const TRIPCONTRIBUTION &contribution, int sign) const {
+    if (contribution.status == STATUS::Cancelled || contribution.status == STATUS::Completed) {
+        return;
+    }
+    if (contribution.startKey > todayKey) {
+        adjust(upcomingCount, sign);
+    } else if (contribution.endKey >= todayKey) {
+        adjust(ongoingCount, sign);
+    }
+}
+
+// FUNC: Recount the date-relative counters when the calendar day has changed
+void TRIPSTATISTICS::rebaseToday() const {
+    int nowKey = currentDateKey();
+    if (nowKey == todayKey) {
+        return;
+    }
+
+    todayKey = nowKey;
+    upcomingCount = 0;
+    ongoingCount = 0;
+    for (const auto &entry : contributions) {
+        applyRelativeToToday(entry.second, +1);
+    }
+}
+
+// FUNC: Observer pattern methods
+void TRIPSTATISTICS::onTripAdded(const string &tripID) {
+    const TRIP *trip = tripManager ? tripManager->findTripById(tripID) : nullptr;
+    if (!trip || contributions.count(tripID)) {
+        return;
+    }
+
+    rebaseToday();
+    TRIPCONTRIBUTION contribution = makeContribution(*trip);
+    apply(contribution, +1);
+    contributions.emplace(tripID, contribution);
+}
+
+void TRIPSTATISTICS::onTripRemoved(const string &tripID) {
+    auto it = contributions.find(tripID);
+    if (it == contributions.end()) {
+        return;
+    }
+
+    rebaseToday();
+    apply(it->second, -1);
+    contributions.erase(it);
+}
+
+void TRIPSTATISTICS::onTripUpdated(const string &tripID) {
+    onTripRemoved(tripID);
+    onTripAdded(tripID);
+}
+
+void TRIPSTATISTICS::onPersonAdded(const string &personID) { (void)personID; }
+void TRIPSTATISTICS::onPersonRemoved(const string &personID) { (void)personID; }
+void TRIPSTATISTICS::onPersonUpdated(const string &personID) { (void)personID; }
+
+// FUNC: Getters
+size_t TRIPSTATISTICS::getTripCount() const { return contributions.size(); }
+
+size_t TRIPSTATISTICS::getStatusCount(STATUS status) const { return statusCounts[statusSlot(status)]; }
+
+size_t TRIPSTATISTICS::getDestinationCount(const string &destination) const {
+    auto it = destinationCounts.find(destination);
+    return (it != destinationCounts.end()) ? it->second : 0;
+}
+
+size_t TRIPSTATISTICS::getMonthCount(int year, int month) const {
+    auto it = monthCounts.find(year * 100 + month);
+    return (it != monthCounts.end()) ? it->second : 0;
+}
+
+size_t TRIPSTATISTICS::getDistinctDestinationCount() const { return destinationCounts.size(); }
+
+size_t TRIPSTATISTICS::getTotalMembers() const { return totalMembers; }
+
+size_t TRIPSTATISTICS::getHostedTripCount() const { return hostedTrips; }
+
+size_t TRIPSTATISTICS::getUpcomingCount() const {
+    rebaseToday();
+    return upcomingCount;
+}
+
+size_t TRIPSTATISTICS::getOngoingCount() const {
+    rebaseToday();
+    return ongoingCount;
+}
@@ -0,0 +1,71 @@
+#ifndef TRIPSTATISTICS_H
+#define TRIPSTATISTICS_H
+
+#include <string>
+#include <unordered_map>
+
+#include "../Models/header.h"
+#include "Observer.h"
+
+using namespace std;
+
+class TRIPMANAGER;
+
+// What a single trip adds to the counters, kept so removals can be undone without the trip itself
+struct TRIPCONTRIBUTION {
+    STATUS status;
+    string destination;
+    int monthKey;  // YYYYMM of the start date
+    int startKey;  // YYYYMMDD
+    int endKey;    // YYYYMMDD
+    size_t memberCount;
+    bool hasHost;
+};
+
+// CLASS: TRIPSTATISTICS - counters kept up to date from TRIPMANAGER notifications
+class TRIPSTATISTICS : public OBSERVER {
+   private:
+    const TRIPMANAGER *tripManager;
+    unordered_map<string, TRIPCONTRIBUTION> contributions;
+
+    size_t statusCounts[4];
+    unordered_map<string, size_t> destinationCounts;
+    unordered_map<int, size_t> monthCounts;
+    size_t totalMembers;
+    size_t hostedTrips;
+
+    // Counters relative to today; rebased at most once per day
+    mutable int todayKey;
+    mutable size_t upcomingCount;
+    mutable size_t ongoingCount;
+
+    void apply(const TRIPCONTRIBUTION &contribution, int sign);
+    void applyRelativeToToday(const TRIPCONTRIBUTION &contribution, int sign) const;
+    void rebaseToday() const;
+
+   public:
+    explicit TRIPSTATISTICS(const TRIPMANAGER *tripManager);
+
+    static int currentDateKey();
+
+    // Observer pattern methods
+    void onTripAdded(const string &tripID) override;
+    void onTripRemoved(const string &tripID) override;
+    void onTripUpdated(const string &tripID) override;
+    void onPersonAdded(const string &personID) override;
+    void onPersonRemoved(const string &personID) override;
+    void onPersonUpdated(const string &personID) override;
+
+    // FUNC: Getters
+    size_t getTripCount() const;
+    size_t getStatusCount(STATUS status) const;
+    size_t getDestinationCount(const string &destination) const;
+    size_t getMonthCount(int year, int month) const;
+    size_t getDistinctDestinationCount() const;
+    size_t getTotalMembers() const;
+    size_t getHostedTripCount() const;
+    size_t getUpcomingCount() const;
+    size_t getOngoingCount() const;
+};
+
+#endif  // TRIPSTATISTICS_H
@@ -26,6 +26,8 @@ std::string DATE::toString() const {
 }
 
 // FUNC: Utility methods
+int DATE::toKey() const { return this->year * 10000 + this->month * 100 + this->day; }
+
 bool DATE::operator<(const DATE &rhs) const {
     if (this->year != rhs.year) {
         return this->year < rhs.year;
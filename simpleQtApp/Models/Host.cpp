@@ -11,7 +11,7 @@ HOST::HOST(const string &_id, const string &_fullName, const GENDER &_gender, co
 // FUNC: Getters
 vector<string> HOST::getHostedTripIDs() const { return this->hostedTripID; }
 
-string HOST::getEmergencyContact() const { return this->emergencyContact; }
+const string &HOST::getEmergencyContact() const { return this->emergencyContact; }
 
 string HOST::getRole() const { return "Host"; }
 
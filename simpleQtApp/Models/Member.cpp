@@ -6,7 +6,7 @@ using namespace std;
 MEMBER::MEMBER() : PERSON(), emergencyContact(""), hasDriverLicense(false), totalSpent(0.0) {}
 
 MEMBER::MEMBER(const string &_id, const string &_fullName, const GENDER &_gender, const DATE &_dob)
-    : PERSON(_id, _fullName, _gender, _dob) {}
+    : PERSON(_id, _fullName, _gender, _dob), emergencyContact(""), hasDriverLicense(false), totalSpent(0.0) {}
 
 // FUNC: Getters
 vector<string> MEMBER::getJoinedTripIDs() const { return this->joinedTripID; }
@@ -20,11 +20,11 @@ string MEMBER::getLastJoinedTripID() const {
 
 int MEMBER::getJoinedTripCount() const { return this->joinedTripID.size(); }
 
-string MEMBER::getEmergencyContact() const { return this->emergencyContact; }
+const string &MEMBER::getEmergencyContact() const { return this->emergencyContact; }
 
 bool MEMBER::getHasDriverLicense() const { return this->hasDriverLicense; }
 
-vector<string> MEMBER::getInterests() const { return this->interests; }
+const vector<string> &MEMBER::getInterests() const { return this->interests; }
 
 double MEMBER::getTotalSpent() const { return (this->totalSpent >= 0) ? this->totalSpent : 0.0; }
 
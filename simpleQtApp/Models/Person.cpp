@@ -22,11 +22,11 @@ string PERSON::getRole() const { return "Person"; }
 string PERSON::getInfo() const { return this->toString(); }
 
 // FUNC: Getters
-string PERSON::getFullName() const { return this->fullName; }
-string PERSON::getID() const { return this->ID; }
-string PERSON::getEmail() const { return this->email; }
-string PERSON::getPhoneNumber() const { return this->phoneNumber; }
-string PERSON::getAddress() const { return this->address; }
+const string &PERSON::getFullName() const { return this->fullName; }
+const string &PERSON::getID() const { return this->ID; }
+const string &PERSON::getEmail() const { return this->email; }
+const string &PERSON::getPhoneNumber() const { return this->phoneNumber; }
+const string &PERSON::getAddress() const { return this->address; }
 GENDER PERSON::getGender() const { return this->gender; }
 DATE PERSON::getDateOfBirth() const { return this->dateOfBirth; }
 
@@ -89,11 +89,11 @@ string TRIP::idProcess() const {
 }
 
 // FUNC: Getters
-string TRIP::getID() const { return this->ID; }
+const string &TRIP::getID() const { return this->ID; }
 
-string TRIP::getDestination() const { return this->Destination; }
+const string &TRIP::getDestination() const { return this->Destination; }
 
-string TRIP::getDescription() const { return this->Description; }
+const string &TRIP::getDescription() const { return this->Description; }
 
 DATE TRIP::getStartDate() const { return this->startDate; }
 
@@ -116,9 +116,11 @@ string TRIP::getStatusString() const {
     }
 }
 
-HOST TRIP::getHost() const { return this->host; }
+const HOST &TRIP::getHost() const { return this->host; }
 
-vector<MEMBER> TRIP::getMembers() const { return this->members; }
+const vector<MEMBER> &TRIP::getMembers() const { return this->members; }
+
+size_t TRIP::getMemberCount() const { return this->members.size(); }
 
 // int TRIP::getTripCount() { return tripCount; }
 
@@ -140,20 +142,44 @@ void TRIP::addMember(MEMBER member) {
     auto it = find_if(members.begin(), members.end(),
                       [&](const MEMBER &_member) { return member.getID() == _member.getID(); });
 
-    // Add member to trip if not exist
+    // Add member to trip if not exist (the stored copy records the trip, not the caller's argument)
     if (it == members.end()) {
         members.push_back(member);
-        member.joinTrip(this->getID());
+        members.back().joinTrip(this->getID());
+    }
+}
+
+bool TRIP::removeMember(const string &memberID) {
+    auto it = find_if(members.begin(), members.end(),
+                      [&](const MEMBER &_member) { return _member.getID() == memberID; });
+    if (it == members.end()) {
+        return false;
     }
+    members.erase(it);
+    return true;
+}
+
+// FUNC: Swap in the current record for a member (the ID may have changed)
+bool TRIP::replaceMember(const string &memberID, const MEMBER &replacement) {
+    auto it = find_if(members.begin(), members.end(),
+                      [&](const MEMBER &_member) { return _member.getID() == memberID; });
+    if (it == members.end()) {
+        return false;
+    }
+    *it = replacement;
+    it->joinTrip(this->getID());
+    return true;
 }
 
 void TRIP::setMembers(const vector<MEMBER> &members) { this->members = members; }
 
 void TRIP::setHost(HOST _host) {
     this->host = _host;
-    _host.hostTrip(this->getID());
+    this->host.hostTrip(this->getID());
 }
 
+void TRIP::clearHost() { this->host = HOST(); }
+
 bool TRIP::hasHost() const { return !this->host.getID().empty(); }
 
 TRIP &TRIP::operator=(const TRIP &other) {
@@ -54,6 +54,7 @@ class DATE {
 
     // FUNC: Utility methods
     string toString() const;
+    int toKey() const;  // YYYYMMDD, ordered like operator<
 
     DATE &operator=(const DATE &other);
     bool operator<(const DATE &rhs) const;
@@ -77,11 +78,11 @@ class PERSON {
     virtual string getInfo() const;
 
     // FUNC: Getters
-    string getFullName() const;
-    string getID() const;
-    string getEmail() const;
-    string getPhoneNumber() const;
-    string getAddress() const;
+    const string &getFullName() const;
+    const string &getID() const;
+    const string &getEmail() const;
+    const string &getPhoneNumber() const;
+    const string &getAddress() const;
     GENDER getGender() const;
     DATE getDateOfBirth() const;
     string toString() const;
@@ -117,9 +118,9 @@ class MEMBER : public PERSON {
     vector<string> getJoinedTripIDs() const;
     string getLastJoinedTripID() const;
     int getJoinedTripCount() const;
-    string getEmergencyContact() const;
+    const string &getEmergencyContact() const;
     bool getHasDriverLicense() const;
-    vector<string> getInterests() const;
+    const vector<string> &getInterests() const;
     double getTotalSpent() const;
     string getRole() const override;
     string getInfo() const override;
@@ -147,7 +148,7 @@ class HOST : public PERSON {
 
     // FUNC: Getters
     vector<string> getHostedTripIDs() const;
-    string getEmergencyContact() const;
+    const string &getEmergencyContact() const;
     string getRole() const override;
     string getInfo() const override;
 
@@ -181,17 +182,18 @@ class TRIP {
 
     // NOTE: Getters
     string idProcess() const;
-    string getID() const;
-    string getDestination() const;
-    string getDescription() const;
+    const string &getID() const;
+    const string &getDestination() const;
+    const string &getDescription() const;
     DATE getStartDate() const;
     DATE getEndDate() const;
     STATUS getStatus() const;
     string getStatusString() const;
     static int getTripCount();
 
-    HOST getHost() const;
-    vector<MEMBER> getMembers() const;
+    const HOST &getHost() const;
+    const vector<MEMBER> &getMembers() const;
+    size_t getMemberCount() const;
 
     // NOTE: Setters
     void setID(const string &_ID);
@@ -203,8 +205,11 @@ class TRIP {
 
     // FUNC: Utility methods
     void addMember(MEMBER member);
+    bool removeMember(const string &memberID);
+    bool replaceMember(const string &memberID, const MEMBER &replacement);
     void setMembers(const vector<MEMBER> &members);
     void setHost(HOST _host);
+    void clearHost();
     bool hasHost() const;
 
     TRIP &operator=(const TRIP &other);
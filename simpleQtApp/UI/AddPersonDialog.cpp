@@ -274,22 +274,16 @@ bool AddPersonDialog::validateNoDuplicate() {
     QDate dob = dobDateEdit->date();
     DATE currentDateOfBirth(dob.day(), dob.month(), dob.year());
 
-    vector<PERSON> people = personManager->getAllPeople();
-
-    for (const PERSON &person : people) {
-        bool samePhoneNumber = (person.getPhoneNumber() == currentPhoneNumber);
-        bool sameEmail = (person.getEmail() == currentEmail);
-
-        if (samePhoneNumber && !currentPhoneNumber.empty()) {
-            QMessageBox::warning(this, "Duplicate phone number", "A person with this phone number already existed!");
-            phoneLineEdit->setFocus();
-            return false;
-        }
-        if (sameEmail && !currentEmail.empty()) {
-            QMessageBox::warning(this, "Duplicate email", "A person with this email already existed!");
-            emailLineEdit->setFocus();
-            return false;
-        }
+    // Normalized hash lookups in PERSONMANAGER instead of copying and scanning everyone
+    if (!currentPhoneNumber.empty() && !personManager->findPhoneOwner(currentPhoneNumber).empty()) {
+        QMessageBox::warning(this, "Duplicate phone number", "A person with this phone number already existed!");
+        phoneLineEdit->setFocus();
+        return false;
+    }
+    if (!currentEmail.empty() && !personManager->findEmailOwner(currentEmail).empty()) {
+        QMessageBox::warning(this, "Duplicate email", "A person with this email already existed!");
+        emailLineEdit->setFocus();
+        return false;
     }
     return true;
 }
@@ -308,13 +302,22 @@ void AddPersonDialog::onCancelClicked() {
     }
 }
 
+// FUNC: ID for the name and birth date; a clash with someone else gets the next free suffix
+string AddPersonDialog::proposePersonID(const string &fullName, const DATE &dob) const {
+    if (!personManager) {
+        return PERSONFACTORY::generatePersonID(fullName, dob);
+    }
+    IDALLOCATOR ids = personManager->makeIDAllocator();
+    return PERSONFACTORY::generatePersonID(fullName, dob, ids);
+}
+
 void AddPersonDialog::onFullNameChanged() {
     QString text = fullNameLineEdit->text().toUpper();
     if (!text.isEmpty()) {
         QDate dob = dobDateEdit->date();
         DATE dobObj(dob.day(), dob.month(), dob.year());
 
-        string newID = PERSONFACTORY::generatePersonID(text.toStdString(), dobObj);
+        string newID = proposePersonID(text.toStdString(), dobObj);
 
         idLineEdit->setText(QString::fromStdString(newID));
     }
@@ -326,7 +329,7 @@ void AddPersonDialog::onDateOfBirthChanged() {
         QDate dob = dobDateEdit->date();
         DATE dobObj(dob.day(), dob.month(), dob.year());
 
-        string newID = PERSONFACTORY::generatePersonID(fullName.toStdString(), dobObj);
+        string newID = proposePersonID(fullName.toStdString(), dobObj);
 
         idLineEdit->setText(QString::fromStdString(newID));
     }
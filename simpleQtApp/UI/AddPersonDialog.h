@@ -44,6 +44,7 @@ class AddPersonDialog : public QDialog {
     void updateFormVisibility();
     bool validateInput();
     bool validateNoDuplicate();
+    string proposePersonID(const string &fullName, const DATE &dob) const;
 
     // UI Components
     QComboBox *personTypeCombo;
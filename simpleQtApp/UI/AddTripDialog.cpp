@@ -19,13 +19,14 @@
 #include <QTextEdit>
 #include <QVBoxLayout>
 
+#include "../Managers/BookingConflicts.h"
 #include "Models/header.h"
 
 // Register types with Qt's meta-object system
 Q_DECLARE_METATYPE(HOST *)
 Q_DECLARE_METATYPE(MEMBER *)
 
-AddTripDialog::AddTripDialog(QWidget *parent) : QDialog(parent), personManager(nullptr) {
+AddTripDialog::AddTripDialog(QWidget *parent) : QDialog(parent), personManager(nullptr), tripManager(nullptr) {
     setupUI();
     setWindowTitle("Add New Trip");
     setModal(true);
@@ -41,7 +42,7 @@ AddTripDialog::AddTripDialog(QWidget *parent) : QDialog(parent), personManager(n
 }
 
 AddTripDialog::AddTripDialog(PERSONMANAGER *personManager, QWidget *parent)
-    : QDialog(parent), personManager(personManager) {
+    : QDialog(parent), personManager(personManager), tripManager(nullptr) {
     setupUI();
     setWindowTitle("Add New Trip");
     setModal(true);
@@ -517,6 +518,8 @@ void AddTripDialog::setupPeopleSelection() {
     // Connect signals
     connect(hostsListWidget, &QListWidget::itemSelectionChanged, this, &AddTripDialog::onHostSelectionChanged);
     connect(hostSearchBar, &QTextEdit::textChanged, this, &AddTripDialog::updateHostList);
+    connect(startDateEdit, &QDateEdit::dateChanged, this, &AddTripDialog::updateHostList);
+    connect(endDateEdit, &QDateEdit::dateChanged, this, &AddTripDialog::updateHostList);
     connect(clearHostSearchButton, &QPushButton::clicked, [this]() {
         hostSearchBar->clear();
         updateHostList();
@@ -569,7 +572,7 @@ void AddTripDialog::updateMemberList() {
     membersListWidget->clear();
 
     // Get all people
-    vector<MEMBER> members = personManager->getAllMembers();
+    const vector<MEMBER> &members = personManager->getAllMembers();
     QString memberSearchName = memberSearchBar->toPlainText().trimmed();
 
     // Populate members list widget - Store ID instead of pointer
@@ -621,9 +624,17 @@ void AddTripDialog::updateHostList() {
     hostsListWidget->clear();
 
     // Get all hosts and apply search filter
-    vector<HOST> hosts = personManager->getAllHosts();
+    const vector<HOST> &hosts = personManager->getAllHosts();
     QString hostSearchName = hostSearchBar->toPlainText().trimmed();
 
+    // Only hosts free for the chosen dates are offered (the selected one stays, marked busy)
+    QDate startDate = startDateEdit->date();
+    QDate endDate = endDateEdit->date();
+    DATE start(startDate.day(), startDate.month(), startDate.year());
+    DATE end(endDate.day(), endDate.month(), endDate.year());
+    bool filterByDates = tripManager && startDate <= endDate;
+    int busyCount = 0;
+
     // Populate hosts list widget
     for (const HOST &host : hosts) {
         QString hostInfo = QString("%1 (ID: %2)")
@@ -635,8 +646,16 @@ void AddTripDialog::updateHostList() {
             continue;
         }
 
-        QListWidgetItem *item = new QListWidgetItem(hostInfo);
         QString hostID = QString::fromStdString(host.getID());
+        if (filterByDates && !hostAvailability.isFree(host.getID(), start, end)) {
+            if (hostID != selectedHostID) {
+                ++busyCount;
+                continue;
+            }
+            hostInfo += " - busy on these dates";
+        }
+
+        QListWidgetItem *item = new QListWidgetItem(hostInfo);
         item->setData(Qt::UserRole, hostID);
 
         hostsListWidget->addItem(item);
@@ -647,6 +666,8 @@ void AddTripDialog::updateHostList() {
         }
     }
 
+    hostGroupBox->setTitle(busyCount > 0 ? QString("🏠 Select Host (%1 busy on these dates)").arg(busyCount)
+                                         : QString("🏠 Select Host"));
     updateSelectedCounts();
 }
 
@@ -840,7 +861,13 @@ void AddTripDialog::acceptDialog() {
         std::string destination = destinationLineEdit->text().trimmed().toUpper().toStdString();
         std::string description = descriptionTextEdit->toPlainText().trimmed().toStdString();
 
-        _tripData = TRIPFACTORY::createTrip(destination, description, startDateObj, endDateObj, tripStatus);
+        // Another trip to the same place on the same day (any year) gets the next free suffix
+        if (tripManager) {
+            IDALLOCATOR ids = tripManager->makeIDAllocator();
+            _tripData = TRIPFACTORY::createTrip(destination, description, startDateObj, endDateObj, tripStatus, &ids);
+        } else {
+            _tripData = TRIPFACTORY::createTrip(destination, description, startDateObj, endDateObj, tripStatus);
+        }
 
         // Add selected host and members to the trip
         if (personManager) {
@@ -871,6 +898,10 @@ void AddTripDialog::acceptDialog() {
             }
         }
 
+        if (!confirmBookingConflicts(this, tripManager, _tripData)) {
+            return;
+        }
+
         accept();
 
     } catch (const std::exception &e) {
@@ -885,4 +916,12 @@ void AddTripDialog::acceptDialog() {
 
 void AddTripDialog::rejectDialog() { reject(); }
 
+void AddTripDialog::setTripManager(const TRIPMANAGER *manager) {
+    tripManager = manager;
+    if (tripManager) {
+        hostAvailability.rebuild(*tripManager);
+    }
+    updateHostList();
+}
+
 TRIP AddTripDialog::getTripData() const { return _tripData; }
@@ -17,8 +17,10 @@
 #include <QVBoxLayout>
 #include <QVariant>
 
+#include "../Managers/HostAvailability.h"
 #include "../Managers/PersonManager.h"
 #include "../Managers/TripFactory.h"
+#include "../Managers/TripManager.h"
 #include "../Models/header.h"
 
 class AddTripDialog : public QDialog {
@@ -29,6 +31,9 @@ class AddTripDialog : public QDialog {
     explicit AddTripDialog(PERSONMANAGER *personManager, QWidget *parent = nullptr);
     TRIP getTripData() const;
 
+    // Trips the new one is checked against for double bookings and host availability
+    void setTripManager(const TRIPMANAGER *manager);
+
    private slots:
     void acceptDialog();
     void rejectDialog();
@@ -77,6 +82,8 @@ class AddTripDialog : public QDialog {
     // Data
     TRIP _tripData;
     PERSONMANAGER *personManager;
+    const TRIPMANAGER *tripManager;
+    HOSTAVAILABILITY hostAvailability;  // Booked dates per host, taken when the trip manager is set
     QSet<QString> selectedMemberIDs;
 };
 
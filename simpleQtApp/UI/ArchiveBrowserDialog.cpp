@@ -0,0 +1,89 @@
+#include "ArchiveBrowserDialog.h"
+
+#include <QFileInfo>
+#include <QMessageBox>
+#include <QScrollBar>
+
+#include "ViewTripDialog.h"
+
+ArchiveBrowserDialog::ArchiveBrowserDialog(const QString &archivePath, PERSONMANAGER *personManager, QWidget *parent)
+    : QDialog(parent), model(nullptr), personManager(personManager), loaded(false) {
+    setWindowTitle("Trip Archive - " + QFileInfo(archivePath).fileName());
+    setModal(true);
+    setMinimumSize(900, 600);
+
+    store.setPersonManager(personManager);
+    loaded = store.open(archivePath);
+
+    model = new ArchiveTripModel(&store, this);
+    setupUI();
+    updateStoreInfo();
+
+    // Center the dialog
+    if (parent) {
+        move(parent->geometry().center() - rect().center());
+    }
+}
+
+bool ArchiveBrowserDialog::isLoaded() const { return loaded; }
+
+void ArchiveBrowserDialog::setupUI() {
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+
+    storeInfoLabel = new QLabel();
+    storeInfoLabel->setStyleSheet("QLabel { font-size: 13px; color: #666; }");
+
+    tripsView = new QTableView();
+    tripsView->setModel(model);
+    tripsView->setSelectionBehavior(QAbstractItemView::SelectRows);
+    tripsView->setSelectionMode(QAbstractItemView::SingleSelection);
+    tripsView->setAlternatingRowColors(true);
+    tripsView->horizontalHeader()->setStretchLastSection(true);
+    // Fixed row heights keep the view from hydrating every row to measure it
+    tripsView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    tripsView->verticalHeader()->setDefaultSectionSize(28);
+
+    QHBoxLayout *buttonLayout = new QHBoxLayout();
+    viewTripButton = new QPushButton("🔍 View Detail");
+    closeButton = new QPushButton("Close");
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(viewTripButton);
+    buttonLayout->addWidget(closeButton);
+
+    mainLayout->addWidget(storeInfoLabel);
+    mainLayout->addWidget(tripsView);
+    mainLayout->addLayout(buttonLayout);
+
+    connect(viewTripButton, &QPushButton::clicked, this, &ArchiveBrowserDialog::onViewTripClicked);
+    connect(closeButton, &QPushButton::clicked, this, &QDialog::accept);
+    connect(tripsView, &QTableView::doubleClicked, this, &ArchiveBrowserDialog::onViewTripClicked);
+    connect(tripsView->verticalScrollBar(), &QScrollBar::valueChanged, this, &ArchiveBrowserDialog::updateStoreInfo);
+}
+
+void ArchiveBrowserDialog::updateStoreInfo() {
+    storeInfoLabel->setText(QString("%1 trips  |  index: %2 KB  |  hydrated: %3  |  cache hits: %4 / misses: %5")
+                                .arg(store.size())
+                                .arg(store.getIndexBytes() / 1024)
+                                .arg(store.getHydratedCount())
+                                .arg(store.getCacheHits())
+                                .arg(store.getCacheMisses()));
+}
+
+void ArchiveBrowserDialog::onViewTripClicked() {
+    QModelIndex current = tripsView->currentIndex();
+    if (!current.isValid()) {
+        QMessageBox::warning(this, "No Selection", "Please select a trip to view details");
+        return;
+    }
+
+    shared_ptr<const TRIP> trip = model->tripAt(current.row());
+    if (!trip) {
+        return;
+    }
+
+    // Archive trips are read-only, the dialog works on a copy
+    TRIP tripCopy = *trip;
+    ViewTripDialog dialog(tripCopy, personManager, this);
+    dialog.exec();
+    updateStoreInfo();
+}
@@ -0,0 +1,41 @@
+#ifndef ARCHIVEBROWSERDIALOG_H
+#define ARCHIVEBROWSERDIALOG_H
+
+#include <QDialog>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableView>
+#include <QVBoxLayout>
+
+#include "../Managers/LazyTripStore.h"
+#include "../Managers/PersonManager.h"
+#include "ArchiveTripModel.h"
+
+// Read-only browser for large trip archives, backed by LAZYTRIPSTORE
+class ArchiveBrowserDialog : public QDialog {
+    Q_OBJECT
+
+   public:
+    explicit ArchiveBrowserDialog(const QString &archivePath, PERSONMANAGER *personManager, QWidget *parent = nullptr);
+    bool isLoaded() const;
+
+   private slots:
+    void onViewTripClicked();
+    void updateStoreInfo();
+
+   private:
+    void setupUI();
+
+    LAZYTRIPSTORE store;
+    ArchiveTripModel *model;
+    PERSONMANAGER *personManager;
+    bool loaded;
+
+    QTableView *tripsView;
+    QLabel *storeInfoLabel;
+    QPushButton *viewTripButton;
+    QPushButton *closeButton;
+};
+
+#endif  // ARCHIVEBROWSERDIALOG_H
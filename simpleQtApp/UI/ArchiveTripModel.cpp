@@ -0,0 +1,57 @@
+#include "ArchiveTripModel.h"
+
+ArchiveTripModel::ArchiveTripModel(LAZYTRIPSTORE *store, QObject *parent) : QAbstractTableModel(parent), store(store) {}
+
+int ArchiveTripModel::rowCount(const QModelIndex &parent) const {
+    if (parent.isValid() || !store) {
+        return 0;
+    }
+    return static_cast<int>(store->size());
+}
+
+int ArchiveTripModel::columnCount(const QModelIndex &parent) const { return parent.isValid() ? 0 : 6; }
+
+QVariant ArchiveTripModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    shared_ptr<const TRIP> trip = tripAt(index.row());
+    if (!trip) {
+        return QVariant();
+    }
+
+    switch (index.column()) {
+        case 0:
+            return QString::fromStdString(trip->getID());
+        case 1:
+            return QString::fromStdString(trip->getDestination());
+        case 2:
+            return QString::fromStdString(trip->getDescription());
+        case 3:
+            return QString::fromStdString(trip->getStartDate().toString());
+        case 4:
+            return QString::fromStdString(trip->getEndDate().toString());
+        case 5:
+            return QString::fromStdString(trip->getStatusString());
+        default:
+            return QVariant();
+    }
+}
+
+QVariant ArchiveTripModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    if (orientation == Qt::Vertical) {
+        return section + 1;
+    }
+
+    static const char *headers[] = {"ID", "Destination", "Description", "Start Date", "End Date", "Status"};
+    return (section >= 0 && section < 6) ? QString(headers[section]) : QVariant();
+}
+
+// The store is logically read-only; hydration only fills its LRU
+shared_ptr<const TRIP> ArchiveTripModel::tripAt(int row) const {
+    return (store && row >= 0) ? store->tripAt(static_cast<size_t>(row)) : nullptr;
+}
@@ -0,0 +1,26 @@
+#ifndef ARCHIVETRIPMODEL_H
+#define ARCHIVETRIPMODEL_H
+
+#include <QAbstractTableModel>
+
+#include "../Managers/LazyTripStore.h"
+
+// Table model over LAZYTRIPSTORE: rows are hydrated only when the view asks for them
+class ArchiveTripModel : public QAbstractTableModel {
+    Q_OBJECT
+
+   public:
+    explicit ArchiveTripModel(LAZYTRIPSTORE *store, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    shared_ptr<const TRIP> tripAt(int row) const;
+
+   private:
+    LAZYTRIPSTORE *store;
+};
+
+#endif  // ARCHIVETRIPMODEL_H
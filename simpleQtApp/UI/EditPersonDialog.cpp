@@ -260,11 +260,20 @@ void EditPersonDialog::onFullNameChanged() {
         QDate dobDate = dobDateEdit->date();
         DATE dob(dobDate.day(), dobDate.month(), dobDate.year());
 
-        string newID = PERSONFACTORY::generatePersonID(fullNameLineEdit->text().trimmed().toStdString(), dob);
+        string newID = proposePersonID(fullNameLineEdit->text().trimmed().toStdString(), dob);
         idLineEdit->setText(QString::fromStdString(newID));
     }
 }
 
+// FUNC: ID for the name and birth date; the person's own ID stays available
+string EditPersonDialog::proposePersonID(const string &fullName, const DATE &dob) const {
+    if (!personManager) {
+        return PERSONFACTORY::generatePersonID(fullName, dob);
+    }
+    IDALLOCATOR ids = personManager->makeIDAllocator(originalPerson->getID());
+    return PERSONFACTORY::generatePersonID(fullName, dob, ids);
+}
+
 void EditPersonDialog::onDateOfBirthChanged() {
     // Auto-generate ID based on name and DOB
     if (fullNameLineEdit->text().trimmed().isEmpty()) {
@@ -274,7 +283,7 @@ void EditPersonDialog::onDateOfBirthChanged() {
     QDate dobDate = dobDateEdit->date();
     DATE dob(dobDate.day(), dobDate.month(), dobDate.year());
 
-    string newID = PERSONFACTORY::generatePersonID(fullNameLineEdit->text().trimmed().toStdString(), dob);
+    string newID = proposePersonID(fullNameLineEdit->text().trimmed().toStdString(), dob);
     idLineEdit->setText(QString::fromStdString(newID));
 }
 
@@ -337,33 +346,33 @@ bool EditPersonDialog::validateNoDuplicates() {
     string currentEmail = emailLineEdit->text().trimmed().toStdString();
     string currentPhone = phoneLineEdit->text().trimmed().toStdString();
 
-    const vector<PERSON>& allPeople = personManager->getAllPeople();
-
-    for (const PERSON& person : allPeople) {
-        // Skip the current person being edited (compare by ID)
-        if (originalPerson && person.getID() == originalPerson->getID()) continue;
-
-        // Check for duplicate email
-        if (!currentEmail.empty() && person.getEmail() == currentEmail) {
-            QMessageBox::warning(this, "Duplicate Email",
-                                 QString("Another person already has this email address!\n\n"
-                                         "Existing person: %1 (%2)")
-                                     .arg(QString::fromStdString(person.getFullName()))
-                                     .arg(QString::fromStdString(person.getRole())));
-            emailLineEdit->setFocus();
-            return false;
-        }
+    // The person being edited may keep their own email and phone
+    string currentID = originalPerson ? originalPerson->getID() : string();
+
+    // Check for duplicate email
+    string emailOwner = currentEmail.empty() ? string() : personManager->findEmailOwner(currentEmail, currentID);
+    if (!emailOwner.empty()) {
+        PERSON* person = personManager->findPersonById(emailOwner);
+        QMessageBox::warning(this, "Duplicate Email",
+                             QString("Another person already has this email address!\n\n"
+                                     "Existing person: %1 (%2)")
+                                 .arg(QString::fromStdString(person ? person->getFullName() : emailOwner))
+                                 .arg(QString::fromStdString(person ? person->getRole() : string())));
+        emailLineEdit->setFocus();
+        return false;
+    }
 
-        // Check for duplicate phone
-        if (!currentPhone.empty() && person.getPhoneNumber() == currentPhone) {
-            QMessageBox::warning(this, "Duplicate Phone Number",
-                                 QString("Another person already has this phone number!\n\n"
-                                         "Existing person: %1 (%2)")
-                                     .arg(QString::fromStdString(person.getFullName()))
-                                     .arg(QString::fromStdString(person.getRole())));
-            phoneLineEdit->setFocus();
-            return false;
-        }
+    // Check for duplicate phone
+    string phoneOwner = currentPhone.empty() ? string() : personManager->findPhoneOwner(currentPhone, currentID);
+    if (!phoneOwner.empty()) {
+        PERSON* person = personManager->findPersonById(phoneOwner);
+        QMessageBox::warning(this, "Duplicate Phone Number",
+                             QString("Another person already has this phone number!\n\n"
+                                     "Existing person: %1 (%2)")
+                                 .arg(QString::fromStdString(person ? person->getFullName() : phoneOwner))
+                                 .arg(QString::fromStdString(person ? person->getRole() : string())));
+        phoneLineEdit->setFocus();
+        return false;
     }
 
     return true;
@@ -48,6 +48,7 @@ class EditPersonDialog : public QDialog {
     void populateFields();
     bool validateInput();
     bool validateNoDuplicates();
+    string proposePersonID(const string &fullName, const DATE &dob) const;
 
     // UI Components
     QVBoxLayout *mainLayout;
@@ -1,7 +1,9 @@
 #include "EditTripDialog.h"
 
+#include "../Managers/BookingConflicts.h"
+
 EditTripDialog::EditTripDialog(TRIP &trip, QWidget *parent)
-    : QDialog(parent), originalTrip(trip), editedTrip(trip), personManager(nullptr) {
+    : QDialog(parent), originalTrip(trip), editedTrip(trip), personManager(nullptr), tripManager(nullptr) {
     setWindowTitle("Edit Trip - " + QString::fromStdString(trip.getDestination()));
     setWindowIcon(QIcon(":/icons/edit.png"));
     setModal(true);
@@ -25,6 +27,24 @@ void EditTripDialog::setPersonManager(PERSONMANAGER *manager) {
     populatePeopleSelection();
 }
 
+void EditTripDialog::setTripManager(const TRIPMANAGER *manager) {
+    tripManager = manager;
+    if (tripManager) {
+        hostAvailability.rebuild(*tripManager, originalTrip.getID());
+    }
+    updateHostList();
+    onStartDateChanged();  // The ID preview can now account for the other trips
+}
+
+// FUNC: ID for the form's destination and start date; this trip's own ID stays available
+string EditTripDialog::proposeTripID(const string &destination, const DATE &startDate) const {
+    if (!tripManager) {
+        return TRIPFACTORY::generateTripID(destination, startDate);
+    }
+    IDALLOCATOR ids = tripManager->makeIDAllocator(originalTrip.getID());
+    return TRIPFACTORY::generateTripID(destination, startDate, ids);
+}
+
 void EditTripDialog::setupUI() {
     // Create form fields with compact sizes for left panel
     tripIDLineEdit = new QLineEdit(this);
@@ -274,6 +294,8 @@ void EditTripDialog::setupPeopleSelectionWidget() {
     // Connect signals
     connect(hostComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
             &EditTripDialog::onHostSelectionChanged);
+    connect(startDateEdit, &QDateEdit::dateChanged, this, &EditTripDialog::updateHostList);
+    connect(endDateEdit, &QDateEdit::dateChanged, this, &EditTripDialog::updateHostList);
     connect(membersListWidget, &QListWidget::itemChanged, this, &EditTripDialog::onMembersSelectionChanged);
     connect(selectAllMembersButton, &QPushButton::clicked, this, &EditTripDialog::onSelectAllMembers);
     connect(clearAllMembersButton, &QPushButton::clicked, this, &EditTripDialog::onClearAllMembers);
@@ -433,21 +455,11 @@ void EditTripDialog::updateMembersList() {
         return;
     }
 
-    hostComboBox->clear();
     membersListWidget->clear();
+    updateHostList();
 
-    // Get hosts and members
-    vector<HOST> hosts = personManager->getAllHosts();
-    vector<MEMBER> members = personManager->getAllMembers();
-
-    // Populate host combo box
-    hostComboBox->addItem("--SELECT A HOST--", QString(""));
-    for (const HOST &host : hosts) {
-        QString hostInfo = QString("%1 (ID: %2)")
-                               .arg(QString::fromStdString(host.getFullName()))
-                               .arg(QString::fromStdString(host.getID()));
-        hostComboBox->addItem(hostInfo, QString::fromStdString(host.getID()));
-    }
+    // Get members
+    const vector<MEMBER> &members = personManager->getAllMembers();
 
     // Populate members list
     for (const MEMBER &member : members) {
@@ -465,6 +477,45 @@ void EditTripDialog::updateMembersList() {
     updateSelectedCount();
 }
 
+// FUNC: Host combo box, limited to hosts free for the dates in the form (the selected one stays)
+void EditTripDialog::updateHostList() {
+    if (!personManager) return;
+
+    QString selectedHostID = hostComboBox->currentData().toString();
+    hostComboBox->blockSignals(true);
+    hostComboBox->clear();
+
+    QDate startDate = startDateEdit->date();
+    QDate endDate = endDateEdit->date();
+    DATE start(startDate.day(), startDate.month(), startDate.year());
+    DATE end(endDate.day(), endDate.month(), endDate.year());
+    bool filterByDates = tripManager && startDate <= endDate;
+    int busyCount = 0;
+
+    hostComboBox->addItem("--SELECT A HOST--", QString(""));
+    for (const HOST &host : personManager->getAllHosts()) {
+        QString hostID = QString::fromStdString(host.getID());
+        QString hostInfo = QString("%1 (ID: %2)").arg(QString::fromStdString(host.getFullName())).arg(hostID);
+
+        if (filterByDates && !hostAvailability.isFree(host.getID(), start, end)) {
+            if (hostID != selectedHostID) {
+                ++busyCount;
+                continue;
+            }
+            hostInfo += " - busy on these dates";
+        }
+
+        hostComboBox->addItem(hostInfo, hostID);
+        if (hostID == selectedHostID) {
+            hostComboBox->setCurrentIndex(hostComboBox->count() - 1);
+        }
+    }
+
+    hostComboBox->blockSignals(false);
+    hostGroupBox->setTitle(busyCount > 0 ? QString("HOST (%1 busy on these dates)").arg(busyCount) : QString("HOST"));
+    updateSelectedCount();
+}
+
 void EditTripDialog::onHostSelectionChanged() { updateSelectedCount(); }
 void EditTripDialog::onMembersSelectionChanged() { updateSelectedCount(); }
 
@@ -583,7 +634,7 @@ void EditTripDialog::acceptChanges() {
         editedTrip.setDestination(newDestination);
 
         // IMPORTANT: Generate and set new ID based on new destination and start date
-        string newID = TRIPFACTORY::generateTripID(newDestination, newStartDate);
+        string newID = proposeTripID(newDestination, newStartDate);
         editedTrip.setID(newID);
 
         editedTrip.setDescription(descriptionTextEdit->toPlainText().trimmed().toStdString());
@@ -615,6 +666,10 @@ void EditTripDialog::acceptChanges() {
             editedTrip.setMembers(selectedMembers);
         }
 
+        if (!confirmBookingConflicts(this, tripManager, editedTrip, originalTrip.getID())) {
+            return;
+        }
+
         // Success
         QMessageBox::information(this, "Success", "Trip updated successfully!");
         accept();  // Close dialog with success
@@ -645,7 +700,7 @@ void EditTripDialog::onDestinationChanged() {
         DATE startDateObj(startDate.day(), startDate.month(), startDate.year());
 
         // Generate new ID based on new destination and start date
-        std::string newID = TRIPFACTORY::generateTripID(text.toStdString(), startDateObj);
+        std::string newID = proposeTripID(text.toStdString(), startDateObj);
         tripIDLineEdit->setText(QString::fromStdString(newID));
     }
 }
@@ -656,7 +711,7 @@ void EditTripDialog::onStartDateChanged() {
         QDate startDate = startDateEdit->date();
         DATE startDateObj(startDate.day(), startDate.month(), startDate.year());
 
-        std::string newID = TRIPFACTORY::generateTripID(destination.toStdString(), startDateObj);
+        std::string newID = proposeTripID(destination.toStdString(), startDateObj);
         tripIDLineEdit->setText(QString::fromStdString(newID));
     }
 }
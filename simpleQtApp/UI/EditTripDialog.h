@@ -19,8 +19,10 @@
 #include <QVBoxLayout>
 #include <QVariant>
 
+#include "../Managers/HostAvailability.h"
 #include "../Managers/PersonManager.h"
 #include "../Managers/TripFactory.h"
+#include "../Managers/TripManager.h"
 #include "../Models/header.h"
 
 class EditTripDialog : public QDialog {
@@ -35,6 +37,9 @@ class EditTripDialog : public QDialog {
     // Set PersonManager for people selection
     void setPersonManager(PERSONMANAGER *manager);
 
+    // Set TripManager for double-booking checks and host availability
+    void setTripManager(const TRIPMANAGER *manager);
+
    private slots:
     void acceptChanges();
     void rejectChanges();
@@ -53,8 +58,10 @@ class EditTripDialog : public QDialog {
     void populatePeopleSelection();
     void styleComponents();
     void updateMembersList();
+    void updateHostList();
     void updateSelectedCount();
     bool validatePeopleSelection();
+    string proposeTripID(const string &destination, const DATE &startDate) const;
 
     // Trip data
     TRIP originalTrip;
@@ -62,6 +69,8 @@ class EditTripDialog : public QDialog {
 
     // Manager
     PERSONMANAGER *personManager;
+    const TRIPMANAGER *tripManager;
+    HOSTAVAILABILITY hostAvailability;  // Booked dates per host, without this trip
 
     // Basic form widgets
     QLineEdit *tripIDLineEdit;
@@ -9,9 +9,19 @@
 
 using namespace std;
 
-FilterTripDialog::FilterTripDialog(const std::vector<TRIP> &allTrips,
-                                   QWidget *parent)
-    : QDialog(parent), _allTrips(allTrips), _filteredTrips(allTrips) {
+FilterTripDialog::FilterTripDialog(const TRIPSNAPSHOT &allTrips,
+                                   QWidget *parent, TRIPSTORE *store)
+    : QDialog(parent),
+      _allTrips(allTrips),
+      _filtersApplied(false),
+      _store(store) {
+     if (_store) {
+          _tripPositions.reserve(_allTrips.size());
+          for (size_t i = 0; i < _allTrips.size(); ++i) {
+               _tripPositions.emplace(_allTrips[i].getID(), i);
+          }
+     }
+
      setupUI();
      setWindowTitle("🔍 Filter and Sort Trips");
      setModal(true);
@@ -412,16 +422,29 @@ void FilterTripDialog::setupButtons() {
 
 void FilterTripDialog::applyFilters() {
      _filteredTrips.clear();
-
-     // Apply filters
-     for (const auto &trip : _allTrips) {
-          if (matchesFilters(trip)) {
-               _filteredTrips.push_back(trip);
+     _filtersApplied = true;
+
+     if (_store) {
+          // Exact criteria and ordering happen in the store, case-insensitive text here
+          bool recheck = hasInMemoryCriteria();
+          for (const std::string &id : _store->queryTripIDs(buildQuery())) {
+               auto it = _tripPositions.find(id);
+               if (it != _tripPositions.end() &&
+                   (!recheck || matchesFilters(_allTrips[it->second]))) {
+                    _filteredTrips.push_back(_allTrips[it->second]);
+               }
+          }
+     } else {
+          // Apply filters
+          for (const auto &trip : _allTrips) {
+               if (matchesFilters(trip)) {
+                    _filteredTrips.push_back(trip);
+               }
           }
-     }
 
-     // Apply sorting
-     _filteredTrips = sortTrips(_filteredTrips);
+          // Apply sorting
+          _filteredTrips = sortTrips(_filteredTrips);
+     }
 
      // Update results label
      resultsLabel->setText(QString("Found %1 trips matching criteria")
@@ -688,6 +711,49 @@ bool FilterTripDialog::matchesFilters(const TRIP &trip) const {
      return true;
 }
 
+// The criteria of matchesFilters that SQL evaluates the same way, for TRIPSTORE::queryTripIDs
+TRIPQUERY FilterTripDialog::buildQuery() const {
+     TRIPQUERY query;
+
+     if (destinationComboBox->currentIndex() > 0) {
+          query.destinationEquals = destinationComboBox->currentText().toStdString();
+     }
+
+     if (statusPlanned->isChecked()) query.statuses.insert(STATUS::Planned);
+     if (statusOngoing->isChecked()) query.statuses.insert(STATUS::Ongoing);
+     if (statusCompleted->isChecked()) query.statuses.insert(STATUS::Completed);
+     if (statusCancelled->isChecked()) query.statuses.insert(STATUS::Cancelled);
+
+     if (descriptionCaseSensitive->isChecked()) {
+          QString keywords = descriptionKeywords->text().trimmed();
+          for (const QString &keyword : keywords.split(',', Qt::SkipEmptyParts)) {
+               query.descriptionKeywords.push_back(keyword.trimmed().toStdString());
+          }
+     }
+
+     query.dateFilter = enableDateFilter->isChecked();
+     if (query.dateFilter) {
+          auto toKey = [](const QDate &date) {
+               return date.year() * 10000 + date.month() * 100 + date.day();
+          };
+          query.startFrom = toKey(startDateFrom->date());
+          query.startTo = toKey(startDateTo->date());
+          query.endFrom = toKey(endDateFrom->date());
+          query.endTo = toKey(endDateTo->date());
+     }
+
+     query.sortBy = sortByComboBox->currentIndex();
+     query.ascending = sortAscending->isChecked();
+     return query;
+}
+
+// Case-insensitive text: Qt folds all of Unicode, SQLite only ASCII
+bool FilterTripDialog::hasInMemoryCriteria() const {
+     return !destinationLineEdit->text().trimmed().isEmpty() ||
+            (!descriptionCaseSensitive->isChecked() &&
+             !descriptionKeywords->text().trimmed().isEmpty());
+}
+
 std::vector<TRIP> FilterTripDialog::sortTrips(std::vector<TRIP> trips) const {
      int sortBy = sortByComboBox->currentIndex();
      bool ascending = sortAscending->isChecked();
@@ -728,5 +794,5 @@ std::vector<TRIP> FilterTripDialog::sortTrips(std::vector<TRIP> trips) const {
 }
 
 std::vector<TRIP> FilterTripDialog::getFilteredTrips() const {
-     return _filteredTrips;
+     return _filtersApplied ? _filteredTrips : _allTrips.toVector();
 }
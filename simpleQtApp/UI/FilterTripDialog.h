@@ -17,15 +17,22 @@
 #include <QSpinBox>
 #include <QVBoxLayout>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "Managers/DataStore.h"
+#include "Managers/TripCollection.h"
 #include "Models/header.h"
 
 class FilterTripDialog : public QDialog {
     Q_OBJECT
 
    public:
-    explicit FilterTripDialog(const std::vector<TRIP> &allTrips, QWidget *parent = nullptr);
+    // A store passed in must hold exactly allTrips (TRIPSTORE::canQuery); exact criteria and the
+    // order then run there, case-insensitive text is still matched here
+    explicit FilterTripDialog(const TRIPSNAPSHOT &allTrips, QWidget *parent = nullptr,
+                              TRIPSTORE *store = nullptr);
     std::vector<TRIP> getFilteredTrips() const;
 
    private slots:
@@ -44,11 +51,16 @@ class FilterTripDialog : public QDialog {
     void setupButtons();
 
     bool matchesFilters(const TRIP &trip) const;
+    TRIPQUERY buildQuery() const;
+    bool hasInMemoryCriteria() const;  // Criteria buildQuery leaves out
     std::vector<TRIP> sortTrips(std::vector<TRIP> trips) const;
 
     // Data
-    std::vector<TRIP> _allTrips;
+    TRIPSNAPSHOT _allTrips;              // Shared with TRIPMANAGER, nothing is copied up front
     std::vector<TRIP> _filteredTrips;
+    bool _filtersApplied;
+    TRIPSTORE *_store;
+    std::unordered_map<std::string, size_t> _tripPositions;  // ID -> index in _allTrips, for SQL results
 
     // UI Components - Filter Groups
     QGroupBox *destinationGroup;
@@ -6,7 +6,10 @@
 #include <QMessageBox>
 #include <algorithm>
 
+#include "../Managers/BookingConflicts.h"
+#include "../Managers/DataValidator.h"
 #include "../Managers/FileManager.h"
+#include "../Managers/Logger.h"
 #include "../Managers/Observer.h"
 #include "../Managers/PersonFactory.h"
 #include "../Managers/TripFactory.h"
@@ -14,6 +17,7 @@
 #include "../Models/header.h"
 #include "AddPersonDialog.h"  // Include the new dialog header
 #include "AddTripDialog.h"
+#include "ArchiveBrowserDialog.h"
 #include "EditTripDialog.h"
 #include "FilterTripDialog.h"
 #include "ViewTripDialog.h"
@@ -23,9 +27,20 @@
 // ========================================
 
 MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
-    // Initialize managers first
-    personManager = new PERSONMANAGER();
+    startupTimer.start();
+
+    // Initialize managers first (people are handed over by the startup loader)
+    personManager = new PERSONMANAGER(false);
     tripManager = new TRIPMANAGER();
+    tripStatistics = new TRIPSTATISTICS(tripManager);
+    tripStore = createTripStore(selectedStorageBackend());
+
+    // Trip mutations check their host and members against the live people indexes
+    tripManager->setPeopleLookup([this](const string &id) { return personManager->findMemberById(id) != nullptr; },
+                                 [this](const string &id) { return personManager->findHostById(id) != nullptr; });
+
+    // Statistics must observe first so the counters are current when the window refreshes
+    tripManager->addObserver(tripStatistics);
 
     // Register as observer for both managers
     personManager->addObserver(this);
@@ -36,27 +51,45 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
     setMinimumSize(1200, 900);
     resize(1500, 1000);
 
-    // IMPORTANT: Load people BEFORE loading trips (so attendees can be restored)
-    addDebugMessage("Loading people from cache...");
-    // PersonManager automatically loads people in its constructor
+    // IMPORTANT: People are loaded BEFORE trips (so attendees can be restored); both happen off the UI thread
+    startAsyncLoad();
+}
 
-    // Now load trips with attendees restoration
-    vector<TRIP> cachedTrips;
-    loadCacheFromFile(cachedTrips);  // This now includes attendees restoration
+MainWindow::~MainWindow() {
+    // Stop a startup load that is still running
+    if (startupThread) {
+        startupLoader->cancel();
+        startupThread->wait();
+        delete startupThread;
+        delete startupLoader;
+    }
 
-    // Add cached trips to TripManager (which will trigger observer updates)
-    for (const TRIP &trip : cachedTrips) {
-        tripManager->addTrip(trip);
+    // An unfinished export is abandoned; its temp file is removed and the target left alone
+    if (exportThread) {
+        exportJob->cancel();
+        exportThread->wait();
+        delete exportThread;
+        delete exportJob;
     }
 
-    addDebugMessage("Application initialization completed");
-}
+    // Same for an import: what it already applied is taken out again before anything is saved
+    if (importThread) {
+        importJob->cancel();
+        importThread->wait();
+        importTransaction->rollback();
+        delete importThread;
+        delete importJob;
+        delete importTransaction;
+    }
 
-MainWindow::~MainWindow() {
     addDebugMessage("Saving application state before exit...");
 
-    // Save trips with attendees
-    saveCacheToFile();
+    // Save trips with attendees (a partially loaded session must not overwrite the cache);
+    // after a read-only session this is a no-op
+    if (!startupInProgress && tripManager->hasUnsavedChanges()) {
+        saveCacheToFile();
+        tripStore->flush();
+    }
 
     // PersonManager will save people in its destructor
 
@@ -68,6 +101,8 @@ MainWindow::~MainWindow() {
 
     if (tripManager) {
         tripManager->removeObserver(this);
+        tripManager->removeObserver(tripStatistics);
+        delete tripStatistics;
         delete tripManager;
     }
 
@@ -181,15 +216,19 @@ void MainWindow::setupSidebar() {
 
     filterButton = new QPushButton("🔽 Filter Trips");
     searchButton = new QPushButton("🔍 Search Trips");
-    QPushButton *upcomingButton = new QPushButton("⏰ Upcoming Trips");
-    QPushButton *completedButton = new QPushButton("✅ Completed Trips");
+    upcomingButton = new QPushButton("⏰ Upcoming Trips");
+    completedButton = new QPushButton("✅ Completed Trips");
+    archiveButton = new QPushButton("🗄️ Browse Archive");
     refreshButton = new QPushButton("🔄 Refresh View");
+    validateButton = new QPushButton("🩺 Validate Data");
 
     viewLayout->addWidget(filterButton);
     viewLayout->addWidget(searchButton);
     viewLayout->addWidget(upcomingButton);
     viewLayout->addWidget(completedButton);
+    viewLayout->addWidget(archiveButton);
     viewLayout->addWidget(refreshButton);
+    viewLayout->addWidget(validateButton);
 
     // Add all groups to sidebar
     sidebarLayout->addWidget(quickActionsGroup);
@@ -211,7 +250,9 @@ void MainWindow::setupSidebar() {
     connect(searchButton, &QPushButton::clicked, this, &MainWindow::onSearchTripsClicked);
     connect(upcomingButton, &QPushButton::clicked, this, &MainWindow::onShowUpcomingTripsClicked);
     connect(completedButton, &QPushButton::clicked, this, &MainWindow::onShowCompletedTripsClicked);
+    connect(archiveButton, &QPushButton::clicked, this, &MainWindow::onBrowseArchiveClicked);
     connect(refreshButton, &QPushButton::clicked, this, &MainWindow::onRefreshViewClicked);
+    connect(validateButton, &QPushButton::clicked, this, &MainWindow::onValidateDataClicked);
     connect(importPeopleButton, &QPushButton::clicked, this, &MainWindow::onImportPeopleClicked);
     connect(exportPeopleButton, &QPushButton::clicked, this, &MainWindow::onExportPeopleClicked);
 }
@@ -260,6 +301,24 @@ void MainWindow::setupMainContent() {
 
     displayLayout->addWidget(tripsTable);
 
+    // Paging bar, only shown for the Upcoming/Completed views
+    pagingBar = new QWidget();
+    QHBoxLayout *pagingLayout = new QHBoxLayout(pagingBar);
+    prevPageButton = new QPushButton("◀ Previous");
+    nextPageButton = new QPushButton("Next ▶");
+    pageLabel = new QLabel();
+    pageLabel->setStyleSheet("QLabel { color: #666; }");
+    pagingLayout->addStretch();
+    pagingLayout->addWidget(prevPageButton);
+    pagingLayout->addWidget(pageLabel);
+    pagingLayout->addWidget(nextPageButton);
+    pagingLayout->addStretch();
+    pagingBar->setVisible(false);
+    displayLayout->addWidget(pagingBar);
+
+    connect(prevPageButton, &QPushButton::clicked, this, &MainWindow::onPreviousPageClicked);
+    connect(nextPageButton, &QPushButton::clicked, this, &MainWindow::onNextPageClicked);
+
     // Add to main content layout
     mainContentLayout->addWidget(headerWidget);
     mainContentLayout->addWidget(tripDisplayArea);
@@ -313,67 +372,189 @@ void MainWindow::setupMenuBar() {
     connect(aboutAction, &QAction::triggered, this, &MainWindow::onShowAboutClicked);
 }
 
-void MainWindow::setupStatusBar() { statusBar()->showMessage("Ready"); }
+void MainWindow::setupStatusBar() {
+    progressBar = new QProgressBar();
+    progressBar->setRange(0, 100);
+    progressBar->setMaximumWidth(200);
+    progressBar->setVisible(false);
+    statusBar()->addPermanentWidget(progressBar);
+
+    cancelTaskButton = new QPushButton("Cancel");
+    cancelTaskButton->setVisible(false);
+    statusBar()->addPermanentWidget(cancelTaskButton);
+    connect(cancelTaskButton, &QPushButton::clicked, this, &MainWindow::onCancelTaskClicked);
+
+    statusBar()->showMessage("Ready");
+}
 
 // ========================================
 // CACHE & DATA MANAGEMENT
 // ========================================
 
-void MainWindow::loadCacheFromFile(vector<TRIP> &outputTrips) {
-    if (cacheFileExists()) {
-        addDebugMessage("Loading cached trips from previous session...");
-        size_t previousCount = outputTrips.size();
-
-        // Step 1: Load basic trip data first
-        loadCacheFile(outputTrips);
-
-        // Step 2: Restore attendees using PersonManager
-        addDebugMessage("Restoring trip attendees from cache...");
-        restoreTripAttendeesFromCache(outputTrips, personManager, getCacheFilePath().toStdString());
-
-        size_t loadedCount = outputTrips.size() - previousCount;
-        addDebugMessage(QString("Loaded %1 trips with attendees from cache").arg(loadedCount));
-
-        if (loadedCount > 0) {
-            statusBar()->showMessage(QString("Loaded %1 trips with people data from previous session").arg(loadedCount),
-                                     3000);
-
-            // Debug: Show attendees info for verification
-            for (const TRIP &trip : outputTrips) {
-                HOST host = trip.getHost();
-                vector<MEMBER> members = trip.getMembers();
-
-                if (!host.getID().empty()) {
-                    addDebugMessage(QString("Trip %1 has host: %2")
-                                        .arg(QString::fromStdString(trip.getID()))
-                                        .arg(QString::fromStdString(host.getID())));
-                }
-
-                if (!members.empty()) {
-                    addDebugMessage(QString("Trip %1 has %2 members")
-                                        .arg(QString::fromStdString(trip.getID()))
-                                        .arg(members.size()));
-                }
-            }
-        }
+void MainWindow::startAsyncLoad() {
+    startupInProgress = true;
+    sidebar->setEnabled(false);  // No edits until people and trips are consistent
+    menuBar()->setEnabled(false);
+    progressBar->setValue(0);
+    progressBar->setVisible(true);
+    statusBar()->showMessage("Loading people and trips from previous session...");
+    addDebugMessage("Loading people and trips from cache...");
+
+    startupLoader = new STARTUPLOADER(selectedStorageBackend());
+    STARTUPLOADER *loader = startupLoader;
+
+    startupThread = QThread::create([this, loader]() {
+        loader->run(
+            [this](vector<MEMBER> &&members, vector<HOST> &&hosts) {
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, members = move(members), hosts = move(hosts)]() {
+                        personManager->loadFromSeparateVectors(members, hosts);
+                    },
+                    Qt::QueuedConnection);
+            },
+            [this](vector<TRIP> &&batch, int percentDone) {
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, batch = move(batch), percentDone]() mutable { applyTripBatch(move(batch), percentDone); },
+                    Qt::QueuedConnection);
+            });
+    });
+
+    // Delivered after every queued batch, since all of them are posted from the worker first
+    connect(startupThread, &QThread::finished, this, &MainWindow::finishAsyncLoad);
+    startupThread->start();
+
+    LOG_INFO("Startup: window constructed in", startupTimer.elapsed(), "ms, loading in background");
+}
+
+void MainWindow::applyTripBatch(vector<TRIP> batch, int percentDone) {
+    QElapsedTimer applyTimer;
+    applyTimer.start();
+
+    // Append only the new rows instead of redrawing the table
+    int firstRow = tripsTable->rowCount();
+    tripsTable->setRowCount(firstRow + batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        setTripRow(firstRow + i, batch[i]);
+    }
+
+    // Then hand the batch to TripManager in one go (statistics follow through the observer). The
+    // trips came from the store, so they are saved unless something else was already pending.
+    bool wasSaved = !tripManager->hasUnsavedChanges();
+    tripManager->addTrips(move(batch));
+    if (wasSaved) {
+        tripManager->markSaved();
+    }
+
+    progressBar->setValue(percentDone);
+    updateStatsDisplay();
+    statusBar()->showMessage(QString("Loading trips... %1 loaded").arg(tripManager->getTripCount()));
+
+    tripApplyMs += applyTimer.elapsed();
+}
+
+void MainWindow::finishAsyncLoad() {
+    STARTUPTIMINGS timings = startupLoader->getTimings();
+    timings.applyMs = tripApplyMs;
+    timings.totalMs = startupTimer.elapsed();
+
+    startupThread->deleteLater();
+    startupThread = nullptr;
+    delete startupLoader;
+    startupLoader = nullptr;
+
+    startupInProgress = false;
+    sidebar->setEnabled(true);
+    menuBar()->setEnabled(true);
+    progressBar->setVisible(false);
+    refreshCurrentView();
+    saveCacheToFile();  // Only writes if something besides the stored trips is pending
+
+    LOG_INFO("Startup breakdown: people", timings.peopleLoadMs, "ms | trip parse", timings.tripParseMs,
+             "ms | apply to UI", timings.applyMs, "ms | total", timings.totalMs, "ms");
+
+    size_t loadedCount = tripManager->getTripCount();
+    addDebugMessage(QString("Loaded %1 trips with attendees from cache").arg(loadedCount));
+    if (loadedCount > 0) {
+        statusBar()->showMessage(QString("Loaded %1 trips with people data from previous session").arg(loadedCount),
+                                 3000);
     } else {
-        addDebugMessage("No cache file found. Starting with empty trip list.");
         statusBar()->showMessage("No previous data found - Ready for new trips", 3000);
     }
+    // Double bookings that predate the editor checks (or came in through imports)
+    vector<BOOKINGCONFLICT> conflicts = findBookingConflicts(*tripManager);
+    if (!conflicts.empty()) {
+        LOG_WARNING("Startup found", conflicts.size(), "double bookings:\n" + describeBookingConflicts(conflicts));
+        statusBar()->showMessage(
+            QString("%1 double bookings found - open or edit the trips to resolve them (details in the log)")
+                .arg(conflicts.size()),
+            10000);
+    }
+    addDebugMessage("Application initialization completed");
 }
 
 void MainWindow::saveCacheToFile() {
+    // Clean collection (or changes that were undone): nothing to write
+    if (!tripManager->hasUnsavedChanges()) {
+        tripManager->markSaved();
+        return;
+    }
+
     addDebugMessage("Updating cache file...");
-    std::vector<TRIP> currentTrips = tripManager->getAllTrips();
 
-    saveTripAttendeesToCache(currentTrips, getCacheFilePath().toStdString());
+    // Incremental backends write only the dirty region, whole-file backends rewrite
+    if (tripStore->applyDelta(tripManager->getPendingDelta(), tripManager->getAllTrips())) {
+        tripManager->markSaved();
+    } else {
+        addDebugMessage("Could not write trips to the " + QString::fromStdString(tripStore->getName()) + " store");
+    }
 }
 
 // ========================================
 // DISPLAY UPDATE FUNCTIONS
 // ========================================
 
-void MainWindow::updateTripDisplay(std::vector<TRIP> trips) {
+void MainWindow::setTripRow(int row, const TRIP &trip) {
+    tripsTable->setItem(row, 0, new QTableWidgetItem(QString::fromStdString(trip.getID())));
+    tripsTable->setItem(row, 1, new QTableWidgetItem(QString::fromStdString(trip.getDestination())));
+    tripsTable->setItem(row, 2, new QTableWidgetItem(QString::fromStdString(trip.getDescription())));
+    tripsTable->setItem(row, 3, new QTableWidgetItem(QString::fromStdString(trip.getStartDate().toString())));
+    tripsTable->setItem(row, 4, new QTableWidgetItem(QString::fromStdString(trip.getEndDate().toString())));
+    tripsTable->setItem(row, 5, new QTableWidgetItem(QString::fromStdString(trip.getStatusString())));
+
+    QString status = QString::fromStdString(trip.getStatusString());
+    for (int j = 0; j < 6; ++j) {
+        tripsTable->item(row, j)->setData(Qt::UserRole, status);
+    }
+}
+
+void MainWindow::updateTripDisplay(const std::vector<TRIP> &trips) { fillTripTable(trips); }
+
+void MainWindow::updateTripDisplay(const TRIPSNAPSHOT &trips) { fillTripTable(trips); }
+
+template <typename TRIPRANGE>
+void MainWindow::fillTripTable(const TRIPRANGE &trips) {
+    if (!tripsTable) {
+        return;
+    }
+
+    // Any full-list display leaves the paged status view
+    statusViewActive = false;
+    pagingBar->setVisible(false);
+
+    tripsTable->setRowCount(trips.size());
+
+    int row = 0;
+    for (const TRIP &trip : trips) {
+        setTripRow(row++, trip);
+    }
+
+    updateStatusBar(trips.size());
+}
+
+// Paged display: only the visible rows are touched
+void MainWindow::updateTripDisplay(const vector<const TRIP *> &trips, size_t totalCount) {
     if (!tripsTable) {
         return;
     }
@@ -381,29 +562,68 @@ void MainWindow::updateTripDisplay(std::vector<TRIP> trips) {
     tripsTable->setRowCount(trips.size());
 
     for (size_t i = 0; i < trips.size(); ++i) {
-        const TRIP &trip = trips[i];
-
-        tripsTable->setItem(i, 0, new QTableWidgetItem(QString::fromStdString(trip.getID())));
-        tripsTable->setItem(i, 1, new QTableWidgetItem(QString::fromStdString(trip.getDestination())));
-        tripsTable->setItem(i, 2, new QTableWidgetItem(QString::fromStdString(trip.getDescription())));
-        tripsTable->setItem(i, 3, new QTableWidgetItem(QString::fromStdString(trip.getStartDate().toString())));
-        tripsTable->setItem(i, 4, new QTableWidgetItem(QString::fromStdString(trip.getEndDate().toString())));
-        tripsTable->setItem(i, 5, new QTableWidgetItem(QString::fromStdString(trip.getStatusString())));
-
-        QString status = QString::fromStdString(trip.getStatusString());
-        for (int j = 0; j < 6; ++j) {
-            tripsTable->item(i, j)->setData(Qt::UserRole, status);
-        }
+        setTripRow(i, *trips[i]);
     }
 
-    updateStatusBar(trips);
+    updateStatusBar(totalCount);
+}
+
+void MainWindow::showStatusView(STATUS status, size_t page) {
+    size_t total = tripManager->getStatusViewSize(status);
+    size_t pageCount = max<size_t>(1, (total + TRIPS_PAGE_SIZE - 1) / TRIPS_PAGE_SIZE);
+    page = min(page, pageCount - 1);
+
+    statusViewActive = true;
+    currentViewStatus = status;
+    currentPage = page;
+
+    updateTripDisplay(tripManager->getTripsByStatus(status, page * TRIPS_PAGE_SIZE, TRIPS_PAGE_SIZE), total);
+
+    pagingBar->setVisible(true);
+    pageLabel->setText(QString("Page %1 of %2").arg(page + 1).arg(pageCount));
+    prevPageButton->setEnabled(page > 0);
+    nextPageButton->setEnabled(page + 1 < pageCount);
 }
 
-void MainWindow::updateStatusBar(const vector<TRIP> trips) {
+// Re-render whatever view is active after the data changed
+void MainWindow::refreshCurrentView() {
+    if (statusViewActive) {
+        showStatusView(currentViewStatus, currentPage);
+    } else {
+        updateTripDisplay(tripManager->getAllTrips());
+    }
+}
+
+void MainWindow::updateStatusBar(size_t shownTripCount) {
+    updateStatsDisplay();
+
+    size_t totalTrips = tripStatistics->getTripCount();
+    if (shownTripCount == totalTrips) {
+        statusBar()->showMessage(QString("Ready - %1 trips | %2 ongoing | %3 upcoming")
+                                     .arg(totalTrips)
+                                     .arg(tripStatistics->getOngoingCount())
+                                     .arg(tripStatistics->getUpcomingCount()));
+    } else {
+        statusBar()->showMessage(QString("Ready - showing %1 of %2 trips").arg(shownTripCount).arg(totalTrips));
+    }
+}
+
+// Header and sidebar counters come straight from TRIPSTATISTICS, no trip scan needed
+void MainWindow::updateStatsDisplay() {
     if (statsLabel) {
-        statsLabel->setText(QString("Trips count: %1").arg(trips.size()));
+        statsLabel->setText(QString("Trips count: %1  |  Destinations: %2  |  Members: %3")
+                                .arg(tripStatistics->getTripCount())
+                                .arg(tripStatistics->getDistinctDestinationCount())
+                                .arg(tripStatistics->getTotalMembers()));
+    }
+    if (upcomingButton) {
+        upcomingButton->setText(
+            QString("⏰ Upcoming Trips (%1)").arg(tripStatistics->getStatusCount(STATUS::Planned)));
+    }
+    if (completedButton) {
+        completedButton->setText(
+            QString("✅ Completed Trips (%1)").arg(tripStatistics->getStatusCount(STATUS::Completed)));
     }
-    statusBar()->showMessage(QString("Ready - %1 trips").arg(trips.size()));
 }
 
 void MainWindow::addDebugMessage(const QString &message) {
@@ -416,31 +636,27 @@ void MainWindow::addDebugMessage(const QString &message) {
 // ========================================
 
 void MainWindow::onImportTripsClicked() {
+    if (importThread || exportThread) {
+        QMessageBox::information(this, "Task Running", "Please wait for the current import or export to finish.");
+        return;
+    }
+
     QString fileName = QFileDialog::getOpenFileName(this, "Import Trip Information", getProjectPath(),
                                                     "CSV Files (*.csv);;All Files (*)");
 
     if (!fileName.isEmpty()) {
         addDebugMessage("Starting import from: " + fileName);
-
-        std::vector<TRIP> importedTrips;
-        importTripInfo(importedTrips,
-                       fileName.toStdString());  // Import to temporary vector
-
-        // Add imported trips through TripManager (triggers observer)
-        for (const TRIP &trip : importedTrips) {
-            tripManager->addTrip(trip);
-        }
-
-        addDebugMessage(QString("Import completed. %1 trips loaded.").arg(importedTrips.size()));
-        QMessageBox::information(this, "Import Complete",
-                                 QString("Successfully imported %1 trips.").arg(importedTrips.size()));
+        startImport(IMPORTKIND::Trips, fileName);
     }
 }
 
 void MainWindow::onExportTripsClicked() {
-    std::vector<TRIP> currentTrips = tripManager->getAllTrips();
+    if (exportThread || importThread) {
+        QMessageBox::information(this, "Export Running", "Please wait for the current export to finish.");
+        return;
+    }
 
-    if (currentTrips.empty()) {
+    if (tripManager->getTripCount() == 0) {
         QMessageBox::warning(this, "No Data", "No trips to export. Please import trips first.");
         return;
     }
@@ -451,10 +667,213 @@ void MainWindow::onExportTripsClicked() {
 
     if (!fileName.isEmpty()) {
         addDebugMessage("Exporting to: " + fileName);
-        exportTripsInfo(currentTrips, fileName.toStdString());
-        addDebugMessage("Export completed successfully.");
-        QMessageBox::information(this, "Export Complete",
-                                 QString("Successfully exported %1 trips.").arg(currentTrips.size()));
+        // The snapshot is taken now; edits made while the export runs are not part of it
+        startExport(new EXPORTJOB(tripManager->getAllTrips(), fileName.toStdString()), "trips");
+    }
+}
+
+// FUNC: Run an export job on its own thread; progress and the result come back through the event loop
+void MainWindow::startExport(EXPORTJOB *job, const QString &what) {
+    exportJob = job;
+    exportButton->setEnabled(false);
+    exportPeopleButton->setEnabled(false);
+    progressBar->setValue(0);
+    progressBar->setVisible(true);
+    cancelTaskButton->setVisible(true);
+    statusBar()->showMessage(QString("Exporting %1 %2...").arg(job->getTotalRows()).arg(what));
+
+    exportThread = QThread::create([this, job]() {
+        job->run([this](size_t rowsDone, size_t totalRows) {
+            int percent = static_cast<int>(rowsDone * 100 / max<size_t>(1, totalRows));
+            QMetaObject::invokeMethod(
+                this, [this, percent]() { progressBar->setValue(percent); }, Qt::QueuedConnection);
+        });
+    });
+    connect(exportThread, &QThread::finished, this, [this, what]() { finishExport(what); });
+    exportThread->start();
+}
+
+void MainWindow::finishExport(const QString &what) {
+    EXPORTRESULT result = exportJob->getResult();
+    QString fileName = QFileInfo(QString::fromStdString(exportJob->getFilePath())).fileName();
+
+    exportThread->deleteLater();
+    exportThread = nullptr;
+    delete exportJob;
+    exportJob = nullptr;
+
+    exportButton->setEnabled(true);
+    exportPeopleButton->setEnabled(true);
+    progressBar->setVisible(false);
+    cancelTaskButton->setVisible(false);
+
+    if (result.completed) {
+        double seconds = result.elapsedMs / 1000.0;
+        addDebugMessage(QString("Exported %1 %2 in %3 s").arg(result.rowsWritten).arg(what).arg(seconds));
+        statusBar()->showMessage(QString("Exported %1 %2 to %3").arg(result.rowsWritten).arg(what).arg(fileName), 5000);
+        QMessageBox::information(
+            this, "Export Complete",
+            QString("Successfully exported %1 %2 to %3.").arg(result.rowsWritten).arg(what).arg(fileName));
+    } else if (result.cancelled) {
+        statusBar()->showMessage(QString("Export cancelled - %1 was not changed").arg(fileName), 5000);
+    } else {
+        addDebugMessage(QString("Error exporting %1: %2").arg(what).arg(QString::fromStdString(result.error)));
+        QMessageBox::critical(this, "Export Error",
+                              QString("An error occurred during export: %1").arg(QString::fromStdString(result.error)));
+    }
+}
+
+// FUNC: Parse on a worker; each batch is applied through the event loop so the window stays responsive
+void MainWindow::startImport(IMPORTKIND kind, const QString &fileName) {
+    importJob = new IMPORTJOB(kind, fileName.toStdString());
+    importTransaction = new IMPORTTRANSACTION(*tripManager, *personManager);
+    importInProgress = true;  // Observers redraw and save once at the end
+
+    importButton->setEnabled(false);
+    importPeopleButton->setEnabled(false);
+    progressBar->setValue(0);
+    progressBar->setVisible(true);
+    cancelTaskButton->setVisible(true);
+    statusBar()->showMessage(QString("Importing %1...").arg(QFileInfo(fileName).fileName()));
+    importTimer.start();
+
+    IMPORTJOB *job = importJob;
+    importThread = QThread::create([this, job]() {
+        job->run(
+            [this, job](vector<TRIP> &&batch) {
+                auto parsed = make_shared<vector<TRIP>>(move(batch));
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, job, parsed]() {
+                        // Batches still queued when the user cancels are dropped, not applied and undone
+                        if (!job->isCancelled()) importTransaction->applyTrips(move(*parsed));
+                        job->batchApplied();
+                    },
+                    Qt::QueuedConnection);
+            },
+            [this, job](vector<MEMBER> &&members, vector<HOST> &&hosts) {
+                auto parsedMembers = make_shared<vector<MEMBER>>(move(members));
+                auto parsedHosts = make_shared<vector<HOST>>(move(hosts));
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, job, parsedMembers, parsedHosts]() {
+                        if (!job->isCancelled()) {
+                            importTransaction->applyPeople(move(*parsedMembers), move(*parsedHosts));
+                        }
+                        job->batchApplied();
+                    },
+                    Qt::QueuedConnection);
+            },
+            [this](const IMPORTSTATS &soFar, quint64 fileSize) {
+                int percent = fileSize > 0 ? static_cast<int>(min<quint64>(100, soFar.bytesRead * 100 / fileSize)) : 0;
+                size_t rowsRead = soFar.rowsRead;
+                QMetaObject::invokeMethod(
+                    this, [this, percent, rowsRead]() { showImportProgress(percent, rowsRead); },
+                    Qt::QueuedConnection);
+            });
+    });
+
+    // Delivered after every queued batch, since all of them are posted from the worker first
+    connect(importThread, &QThread::finished, this, &MainWindow::finishImport);
+    importThread->start();
+}
+
+void MainWindow::showImportProgress(int percent, size_t rowsRead) {
+    if (!importJob || importJob->isCancelled()) {
+        return;
+    }
+    qint64 elapsedMs = max<qint64>(1, importTimer.elapsed());
+    progressBar->setValue(percent);
+    updateStatsDisplay();
+    statusBar()->showMessage(
+        QString("Importing... %1 rows read (%2 rows/s)").arg(rowsRead).arg(rowsRead * 1000 / elapsedMs));
+}
+
+void MainWindow::finishImport() {
+    IMPORTKIND kind = importJob->getKind();
+    IMPORTSTATS stats = importJob->getStats();
+    QString error = QString::fromStdString(importJob->getError());
+    bool cancelled = importJob->isCancelled();
+    QString fileName = QFileInfo(QString::fromStdString(importJob->getFilePath())).fileName();
+    qint64 elapsedMs = max<qint64>(1, importTimer.elapsed());
+
+    importThread->deleteLater();
+    importThread = nullptr;
+    delete importJob;
+    importJob = nullptr;
+
+    // A cancelled or failed import leaves the collections as they were before it started
+    size_t added = importTransaction->getAddedCount();
+    size_t duplicates = importTransaction->getDuplicateCount();
+    size_t rejected = importTransaction->getRejectedCount();
+    size_t contactConflicts = importTransaction->getContactConflictCount();
+    if (cancelled || !error.isEmpty()) {
+        importTransaction->rollback();
+    }
+    delete importTransaction;
+    importTransaction = nullptr;
+    importInProgress = false;
+
+    importButton->setEnabled(true);
+    importPeopleButton->setEnabled(true);
+    progressBar->setVisible(false);
+    cancelTaskButton->setVisible(false);
+
+    // One refresh and one cache write for the whole file
+    refreshCurrentView();
+    saveCacheToFile();
+    personManager->saveChanges();
+
+    QString what = (kind == IMPORTKIND::Trips) ? "trips" : "people";
+    if (!error.isEmpty()) {
+        addDebugMessage(QString("Error importing %1: %2").arg(what).arg(error));
+        QMessageBox::critical(this, "Import Error", QString("An error occurred during import: %1").arg(error));
+        return;
+    }
+    if (cancelled) {
+        addDebugMessage(QString("Import of %1 cancelled, %2 %3 rolled back").arg(fileName).arg(added).arg(what));
+        statusBar()->showMessage(QString("Import cancelled - no %1 were added").arg(what), 5000);
+        return;
+    }
+
+    QString summary = QString("Imported %1 %2 from %3 in %4 s (%5 rows/s).\n"
+                              "%6 duplicates skipped, %7 unreadable rows skipped.")
+                          .arg(added)
+                          .arg(what)
+                          .arg(fileName)
+                          .arg(elapsedMs / 1000.0, 0, 'f', 1)
+                          .arg(static_cast<qint64>(stats.rowsRead) * 1000 / elapsedMs)
+                          .arg(duplicates)
+                          .arg(stats.rowsSkipped);
+    if (rejected > 0) {
+        summary += QString("\n%1 rows rejected by strict integrity checks (see the log).").arg(rejected);
+    }
+    if (contactConflicts > 0) {
+        summary += QString("\n%1 imported people share an email or phone number with someone else.")
+                       .arg(contactConflicts);
+    }
+    if (kind == IMPORTKIND::People) {
+        BLOOMSTATS filter = personManager->getDuplicateFilterStats();
+        summary += QString("\nDuplicate pre-filter: %1 exact checks skipped, false-positive rate %2% "
+                           "(target %3%, estimated %4%).")
+                       .arg(filter.definiteMisses)
+                       .arg(filter.observedRate() * 100, 0, 'f', 3)
+                       .arg(filter.targetRate * 100, 0, 'f', 3)
+                       .arg(filter.estimatedRate * 100, 0, 'f', 3);
+    }
+    addDebugMessage(summary);
+    statusBar()->showMessage(QString("Imported %1 %2").arg(added).arg(what), 5000);
+    QMessageBox::information(this, "Import Complete", summary);
+}
+
+void MainWindow::onCancelTaskClicked() {
+    if (exportJob) {
+        exportJob->cancel();
+        statusBar()->showMessage("Cancelling export...");
+    }
+    if (importJob) {
+        importJob->cancel();
+        statusBar()->showMessage("Cancelling import...");
     }
 }
 
@@ -466,9 +885,13 @@ void MainWindow::onAddTripClicked() {
     addDebugMessage("Opening Add Trip dialog...");
 
     AddTripDialog dialog(personManager, this);
+    dialog.setTripManager(tripManager);
     if (dialog.exec() == QDialog::Accepted) {
         TRIP newTrip = dialog.getTripData();
-        tripManager->addTrip(newTrip);
+        if (!tripManager->addTrip(newTrip)) {
+            showIntegrityRejection("The trip was not added");
+            return;
+        }
         QMessageBox::information(
             this, "Trip Added",
             QString("Trip to %1 has been added successfully.").arg(QString::fromStdString(newTrip.getDestination())));
@@ -485,24 +908,38 @@ void MainWindow::onEditTripClicked() {
     }
 
     QString tripIdToEdit = tripsTable->item(currentRow, 0)->text();
-    vector<TRIP> allTrips = tripManager->getAllTrips();
-
-    // Find the trip to edit
-    auto it = find_if(allTrips.begin(), allTrips.end(),
-                      [&](const TRIP &trip) { return trip.getID() == tripIdToEdit.toStdString(); });
 
-    if (it != allTrips.end()) {
-        EditTripDialog editDialog(*it, this);
+    // The dialog works on its own copy of this one trip
+    const TRIP *found = tripManager->findTripById(tripIdToEdit.toStdString());
+    if (found) {
+        TRIP tripToEdit = *found;
+        EditTripDialog editDialog(tripToEdit, this);
         editDialog.setPersonManager(personManager);
+        editDialog.setTripManager(tripManager);
 
         if (editDialog.exec() == QDialog::Accepted) {
             // Update the trip in the manager
-            tripManager->updateTrip(editDialog.getOriginalTrip(), editDialog.getUpdatedTrip());
+            if (!tripManager->updateTrip(editDialog.getOriginalTrip(), editDialog.getUpdatedTrip())) {
+                showIntegrityRejection("The trip was not updated");
+                return;
+            }
             addDebugMessage("Trip updated: " + tripIdToEdit);
         }
     }
 }
 
+// FUNC: Explain a mutation the trip manager turned down (a taken ID, strict integrity, or the trip is gone)
+void MainWindow::showIntegrityRejection(const QString &what) {
+    const INTEGRITYGUARD &integrity = tripManager->getIntegrityGuard();
+    if (integrity.getLastRejectedCount() == 0) {
+        QMessageBox::critical(this, "Error", what + ": it could not be found. Please refresh.");
+        return;
+    }
+    QString issues = QString::fromStdString(integrity.describeLastIssues());
+    addDebugMessage(what + " (integrity check): " + issues.trimmed());
+    QMessageBox::warning(this, "Integrity Check", what + ":\n\n" + issues);
+}
+
 void MainWindow::onDeleteTripClicked() {
     int currentRow = tripsTable->currentRow();
     if (currentRow < 0) {
@@ -543,18 +980,18 @@ void MainWindow::onViewTripDetailsClicked() {
     }
 
     QString tripIdToView = tripsTable->item(currentRow, 0)->text();
-    vector<TRIP> allTrips = tripManager->getAllTrips();
 
-    auto it = find_if(allTrips.begin(), allTrips.end(),
-                      [&](const TRIP &trip) { return trip.getID() == tripIdToView.toStdString(); });
-
-    if (it != allTrips.end()) {
-        ViewTripDialog dialog(*it, personManager, this);  // Pass by reference
+    const TRIP *found = tripManager->findTripById(tripIdToView.toStdString());
+    if (found) {
+        TRIP tripToView = *found;
+        ViewTripDialog dialog(tripToView, personManager, this);  // Pass by reference
 
         if (dialog.exec() == QDialog::Accepted) {
             // Update the trip in the manager
-            tripManager->updateTrip(dialog.getOriginalTrip(), dialog.getUpdatedTrip());
-            updateTripDisplay(tripManager->getAllTrips());  // Refresh table
+            if (!tripManager->updateTrip(dialog.getOriginalTrip(), dialog.getUpdatedTrip())) {
+                showIntegrityRejection("The trip was not updated");
+            }
+            refreshCurrentView();  // Refresh table
         }
     }
 }
@@ -577,13 +1014,15 @@ void MainWindow::onManagePeopleClicked() {
 // ========================================
 
 void MainWindow::onFilterTripsClicked() {
-    std::vector<TRIP> allTrips = tripManager->getAllTrips();
-    FilterTripDialog filterDialog(allTrips, this);
+    TRIPSNAPSHOT allTrips = tripManager->getAllTrips();
+    // Only push filters down when the store holds exactly what is shown
+    bool storeIsCurrent = !startupInProgress &&
+                          tripStore->canQuery(allTrips.size(), tripManager->hasUnsavedChanges());
+    FilterTripDialog filterDialog(allTrips, this, storeIsCurrent ? tripStore.get() : nullptr);
 
     if (filterDialog.exec() == QDialog::Accepted) {
         std::vector<TRIP> filteredTrips = filterDialog.getFilteredTrips();
         updateTripDisplay(filteredTrips);
-        updateStatusBar(filteredTrips);
 
         addDebugMessage(
             QString("Applied filters - showing %1 of %2 trips").arg(filteredTrips.size()).arg(allTrips.size()));
@@ -597,26 +1036,37 @@ void MainWindow::onSearchTripsClicked() {
     QMessageBox::information(this, "Search Trips", "Trip search will be implemented here.");
 }
 
-void MainWindow::onShowUpcomingTripsClicked() {
-    std::vector<TRIP> allTrips = tripManager->getAllTrips();
-    std::vector<TRIP> upcomingTrips;
-    for (const TRIP &trip : allTrips) {
-        if (trip.getStatusString() == "Planned") {
-            upcomingTrips.push_back(trip);
-        }
+void MainWindow::onShowUpcomingTripsClicked() { showStatusView(STATUS::Planned, 0); }
+
+void MainWindow::onShowCompletedTripsClicked() { showStatusView(STATUS::Completed, 0); }
+
+// Archives are browsed through a memory-mapped store instead of being loaded into TRIPMANAGER
+void MainWindow::onBrowseArchiveClicked() {
+    QString fileName = QFileDialog::getOpenFileName(this, "Browse Trip Archive", getProjectPath(),
+                                                    "CSV Files (*.csv);;All Files (*)");
+    if (fileName.isEmpty()) {
+        return;
+    }
+
+    ArchiveBrowserDialog dialog(fileName, personManager, this);
+    if (!dialog.isLoaded()) {
+        QMessageBox::critical(this, "Archive Error", "Could not open the selected archive.");
+        return;
     }
-    updateTripDisplay(upcomingTrips);
+    dialog.exec();
+    addDebugMessage("Browsed archive: " + fileName);
 }
 
-void MainWindow::onShowCompletedTripsClicked() {
-    std::vector<TRIP> allTrips = tripManager->getAllTrips();
-    std::vector<TRIP> completedTrips;
-    for (const TRIP &trip : allTrips) {
-        if (trip.getStatusString() == "Completed") {
-            completedTrips.push_back(trip);
-        }
+void MainWindow::onPreviousPageClicked() {
+    if (statusViewActive && currentPage > 0) {
+        showStatusView(currentViewStatus, currentPage - 1);
+    }
+}
+
+void MainWindow::onNextPageClicked() {
+    if (statusViewActive) {
+        showStatusView(currentViewStatus, currentPage + 1);
     }
-    updateTripDisplay(completedTrips);
 }
 
 void MainWindow::onRefreshViewClicked() {
@@ -635,10 +1085,46 @@ void MainWindow::onRefreshViewClicked() {
 //     }
 // }
 
-// void MainWindow::onValidateDataClicked() {
-//     QMessageBox::information(this, "Validate", "Data validation will be
-//     implemented.");
-// }
+// FUNC: Run every integrity check over the loaded data; the full list goes to the details pane
+void MainWindow::onValidateDataClicked() {
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    VALIDATIONREPORT report =
+        validateData(tripManager->getAllTrips(), personManager->getAllMembers(), personManager->getAllHosts());
+    QApplication::restoreOverrideCursor();
+
+    string summary = report.summary();
+    addDebugMessage(QString::fromStdString(summary).trimmed());
+
+    if (report.isClean()) {
+        QMessageBox::information(this, "Validate Data",
+                                 QString("No issues found in %1 trips and %2 people (%3 ms).")
+                                     .arg(report.tripsChecked)
+                                     .arg(report.peopleChecked)
+                                     .arg(report.elapsedMs));
+        statusBar()->showMessage("Data validated: no issues.", 3000);
+        return;
+    }
+
+    QString counts;
+    for (size_t check = 0; check < VALIDATION_CHECK_COUNT; ++check) {
+        if (report.counts[check] > 0) {
+            counts += QString("%1: %2\n")
+                          .arg(validationCheckName(static_cast<VALIDATIONCHECK>(check)))
+                          .arg(report.counts[check]);
+        }
+    }
+
+    QMessageBox box(QMessageBox::Warning, "Validate Data",
+                    QString("Found %1 issues in %2 trips and %3 people:\n\n%4")
+                        .arg(report.totalIssues())
+                        .arg(report.tripsChecked)
+                        .arg(report.peopleChecked)
+                        .arg(counts),
+                    QMessageBox::Ok, this);
+    box.setDetailedText(QString::fromStdString(summary));
+    box.exec();
+    statusBar()->showMessage(QString("Data validated: %1 issues.").arg(report.totalIssues()), 3000);
+}
 
 // void MainWindow::onExportDebugLogClicked() {
 //     QMessageBox::information(this, "Export Log", "Debug log export will be
@@ -667,38 +1153,68 @@ void MainWindow::onOpenSettingsClicked() {
 
 // Observer implementation
 void MainWindow::onTripAdded(const std::string &tripId) {
+    // Startup batches draw their own rows and must not rewrite the cache they are read from
+    if (startupInProgress) {
+        return;
+    }
+
     addDebugMessage("Observer: Trip added - " + QString::fromStdString(tripId));
 
-    // Get current trips from manager only
-    std::vector<TRIP> currentTrips = tripManager->getAllTrips();
-    updateTripDisplay(currentTrips);
-    saveCacheToFile();  // This now uses tripManager internally
+    refreshCurrentView();
+    saveCacheToFile();
 
     statusBar()->showMessage(QString("New trip added: %1").arg(QString::fromStdString(tripId)), 3000);
 }
 
+void MainWindow::onTripsAdded(const vector<string> &tripIDs) {
+    // Startup and imports redraw and save once they are done
+    if (startupInProgress || importInProgress) {
+        return;
+    }
+
+    addDebugMessage(QString("Observer: %1 trips added").arg(tripIDs.size()));
+
+    refreshCurrentView();
+    saveCacheToFile();
+}
+
 void MainWindow::onTripRemoved(const std::string &tripId) {
     addDebugMessage("Observer: Trip removed - " + QString::fromStdString(tripId));
 
-    // Get current trips from manager and update display
-    std::vector<TRIP> currentTrips = tripManager->getAllTrips();
-    updateTripDisplay(currentTrips);
-    saveCacheToFile();  // This now uses tripManager internally
+    refreshCurrentView();
+    saveCacheToFile();
 
     statusBar()->showMessage(QString("Trip removed: %1").arg(QString::fromStdString(tripId)), 3000);
 }
 
+void MainWindow::onTripsRemoved(const vector<string> &tripIDs) {
+    // A rolled back import redraws and saves once it is done
+    if (importInProgress) {
+        return;
+    }
+
+    addDebugMessage(QString("Observer: %1 trips removed").arg(tripIDs.size()));
+
+    refreshCurrentView();
+    saveCacheToFile();
+}
+
 void MainWindow::onTripUpdated(const std::string &tripId) {
     addDebugMessage("Observer: Trip updated - " + QString::fromStdString(tripId));
 
-    // Get current trips from manager and update display
-    vector<TRIP> currentTrips = tripManager->getAllTrips();
-    updateTripDisplay(currentTrips);
-    saveCacheToFile();  // This now uses tripManager internally
+    refreshCurrentView();
+    saveCacheToFile();
 
     statusBar()->showMessage(QString("Trip updated: %1").arg(QString::fromStdString(tripId)), 3000);
 }
 
+void MainWindow::onTripsUpdated(const vector<string> &tripIDs) {
+    addDebugMessage(QString("Observer: %1 trips updated").arg(tripIDs.size()));
+
+    refreshCurrentView();
+    saveCacheToFile();
+}
+
 // NEW: Person observer methods
 void MainWindow::onPersonAdded(const string &personID) {
     addDebugMessage("Person added: " + QString::fromStdString(personID));
@@ -707,17 +1223,43 @@ void MainWindow::onPersonAdded(const string &personID) {
 
 void MainWindow::onPersonRemoved(const string &personID) {
     addDebugMessage("Person removed: " + QString::fromStdString(personID));
-    // You can add specific logic here for when a person is removed
+    onPeopleRemoved({personID});
+}
+
+// NOTE: Only the trips the relationship index links to these people are touched
+void MainWindow::onPeopleRemoved(const vector<string> &personIDs) {
+    size_t touched = tripManager->detachPeople(personIDs);
+    if (touched > 0) {
+        addDebugMessage(QString("Removed %1 people from %2 trips").arg(personIDs.size()).arg(touched));
+    }
 }
 
 void MainWindow::onPersonUpdated(const string &personID) {
     addDebugMessage("Person updated: " + QString::fromStdString(personID));
-    // You can add specific logic here for when a person is updated
+    onPersonRenamed(personID, personID);
+}
+
+// FUNC: Push the edited person into the trips that still hold the old copy
+void MainWindow::onPersonRenamed(const string &oldID, const string &newID) {
+    if (oldID != newID) {
+        addDebugMessage("Person renamed: " + QString::fromStdString(oldID) + " -> " + QString::fromStdString(newID));
+    }
+
+    if (MEMBER *member = personManager->findMemberById(newID)) {
+        tripManager->refreshMember(oldID, *member);
+    } else if (HOST *host = personManager->findHostById(newID)) {
+        tripManager->refreshHost(oldID, *host);
+    }
 }
 
 void MainWindow::onImportPeopleClicked() {
     addDebugMessage("Opening People Import dialog...");
 
+    if (importThread || exportThread) {
+        QMessageBox::information(this, "Task Running", "Please wait for the current import or export to finish.");
+        return;
+    }
+
     QString filename = QFileDialog::getOpenFileName(this, "Import People from CSV", getProjectPath(),
                                                     "CSV Files (*.csv);;All Files (*.*)");
 
@@ -725,57 +1267,19 @@ void MainWindow::onImportPeopleClicked() {
         return;  // User canceled
     }
 
-    try {
-        // Get current people to check for duplicates
-        vector<MEMBER> importedMembers;
-        vector<HOST> importedHosts;
-
-        // Import new people
-        importPeopleInfo(importedMembers, importedHosts, filename.toStdString());
-
-        if (importedMembers.empty() && importedHosts.empty()) {
-            QMessageBox::warning(this, "Import Failed", "No people found in the file or the file format is incorrect.");
-            return;
-        }
-
-        int importCount = 0;
-
-        // Add each imported member if they don't already exist
-        for (const MEMBER &member : importedMembers) {
-            // Check if a member with the same ID already exists
-            if (!personManager->findMemberById(member.getID())) {
-                personManager->addMember(member);
-                importCount++;
-            }
-        }
-
-        // Add each imported host if they don't already exist
-        for (const HOST &host : importedHosts) {
-            // Check if a host with the same ID already exists
-            if (!personManager->findHostById(host.getID())) {
-                personManager->addHost(host);
-                importCount++;
-            }
-        }
-
-        QMessageBox::information(this, "Import Successful",
-                                 QString("Successfully imported %1 people.").arg(importCount));
-
-        addDebugMessage(QString("Imported %1 people from %2").arg(importCount).arg(QFileInfo(filename).fileName()));
-
-    } catch (const std::exception &e) {
-        QMessageBox::critical(this, "Import Error", QString("An error occurred during import: %1").arg(e.what()));
-        addDebugMessage(QString("Error importing people: %1").arg(e.what()));
-    }
+    // Already known people are counted as duplicates and left out
+    startImport(IMPORTKIND::People, filename);
 }
 
 void MainWindow::onExportPeopleClicked() {
     addDebugMessage("Opening People Export dialog...");
 
-    const vector<MEMBER> &members = personManager->getAllMembers();
-    const vector<HOST> &hosts = personManager->getAllHosts();
+    if (exportThread || importThread) {
+        QMessageBox::information(this, "Export Running", "Please wait for the current export to finish.");
+        return;
+    }
 
-    if (members.empty() && hosts.empty()) {
+    if (personManager->getPersonCount() == 0) {
         QMessageBox::warning(this, "Export Failed", "There are no people to export.");
         return;
     }
@@ -787,18 +1291,7 @@ void MainWindow::onExportPeopleClicked() {
         return;  // User canceled
     }
 
-    try {
-        exportPeopleInfo(members, hosts, filename.toStdString());
-
-        int totalPeople = members.size() + hosts.size();
-        QMessageBox::information(
-            this, "Export Successful",
-            QString("Successfully exported %1 people to %2.").arg(totalPeople).arg(QFileInfo(filename).fileName()));
-
-        addDebugMessage(QString("Exported %1 people to %2").arg(totalPeople).arg(QFileInfo(filename).fileName()));
-
-    } catch (const std::exception &e) {
-        QMessageBox::critical(this, "Export Error", QString("An error occurred during export: %1").arg(e.what()));
-        addDebugMessage(QString("Error exporting people: %1").arg(e.what()));
-    }
+    vector<MEMBER> members = personManager->getAllMembers();
+    vector<HOST> hosts = personManager->getAllHosts();
+    startExport(new EXPORTJOB(move(members), move(hosts), filename.toStdString()), "people");
 }
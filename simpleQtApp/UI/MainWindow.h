@@ -5,6 +5,7 @@
 #include <QApplication>
 #include <QDateTime>
 #include <QDialog>
+#include <QElapsedTimer>
 #include <QDir>
 #include <QMainWindow>
 #include <QWidget>
@@ -31,6 +32,7 @@
 #include <QTableWidget>
 #include <QTableWidgetItem>
 #include <QTextEdit>
+#include <QThread>
 #include <QTimer>
 #include <QVBoxLayout>
 
@@ -50,10 +52,15 @@
 #include <vector>
 
 // Project Headers
+#include "../Managers/DataStore.h"
+#include "../Managers/ExportJob.h"
 #include "../Managers/FileManager.h"
+#include "../Managers/ImportJob.h"
 #include "../Managers/Observer.h"
 #include "../Managers/PersonManager.h"
+#include "../Managers/StartupLoader.h"
 #include "../Managers/TripManager.h"
+#include "../Managers/TripStatistics.h"
 #include "../Models/header.h"
 #include "ManagePeopleDialog.h"
 
@@ -75,11 +82,16 @@ class MainWindow : public QMainWindow, public OBSERVER {
 
     // Observer pattern methods
     void onTripAdded(const string &tripID) override;
+    void onTripsAdded(const vector<string> &tripIDs) override;
     void onTripRemoved(const string &tripID) override;
+    void onTripsRemoved(const vector<string> &tripIDs) override;
     void onTripUpdated(const string &tripID) override;
+    void onTripsUpdated(const vector<string> &tripIDs) override;
     void onPersonAdded(const string &personID) override;
     void onPersonRemoved(const string &personID) override;
+    void onPeopleRemoved(const vector<string> &personIDs) override;
     void onPersonUpdated(const string &personID) override;
+    void onPersonRenamed(const string &oldID, const string &newID) override;
 
    private slots:
     // File Operations
@@ -102,6 +114,9 @@ class MainWindow : public QMainWindow, public OBSERVER {
     void onRefreshViewClicked();
     void onShowUpcomingTripsClicked();
     void onShowCompletedTripsClicked();
+    void onBrowseArchiveClicked();
+    void onPreviousPageClicked();
+    void onNextPageClicked();
 
     // Help and Settings
     void onShowHelpClicked();
@@ -110,13 +125,16 @@ class MainWindow : public QMainWindow, public OBSERVER {
 
     // Debug Functions
     // void onShowDebugInfoClicked();
-    // void onValidateDataClicked();
+    void onValidateDataClicked();
     // void onExportDebugLogClicked();
 
     // Add these new slots for people import/export
     void onImportPeopleClicked();
     void onExportPeopleClicked();
 
+    // Background tasks
+    void onCancelTaskClicked();
+
    private:
     void setupUI();
     void setupMenuBar();
@@ -125,11 +143,27 @@ class MainWindow : public QMainWindow, public OBSERVER {
     void setupCentralWidget();
     void setupSidebar();
     void setupMainContent();
-    void updateTripDisplay(const std::vector<TRIP> trips);
-    void updateStatusBar(const vector<TRIP>);
+    void updateTripDisplay(const std::vector<TRIP> &trips);
+    void updateTripDisplay(const TRIPSNAPSHOT &trips);  // The whole collection, without copying it
+    template <typename TRIPRANGE>
+    void fillTripTable(const TRIPRANGE &trips);
+    void updateTripDisplay(const vector<const TRIP *> &trips, size_t totalCount);
+    void setTripRow(int row, const TRIP &trip);
+    void showStatusView(STATUS status, size_t page);
+    void refreshCurrentView();
+    void updateStatusBar(size_t shownTripCount);
+    void updateStatsDisplay();
     void addDebugMessage(const QString &message);
-    void loadCacheFromFile(vector<TRIP> &outputTrips);  // Updated to include attendees
-    void saveCacheToFile();                             // Updated to use new save function
+    void showIntegrityRejection(const QString &what);
+    void startAsyncLoad();                                                // Loads caches on a worker thread
+    void applyTripBatch(vector<TRIP> batch, int percentDone);             // Runs on the UI thread
+    void finishAsyncLoad();
+    void saveCacheToFile();                             // Writes unsaved trip changes through the store
+    void startExport(EXPORTJOB *job, const QString &what);  // Takes ownership, runs the job on a worker
+    void finishExport(const QString &what);
+    void startImport(IMPORTKIND kind, const QString &fileName);  // Parses on a worker, applies batches here
+    void showImportProgress(int percent, size_t rowsRead);
+    void finishImport();
 
     // UI Components
     QWidget *centralWidget;
@@ -150,10 +184,17 @@ class MainWindow : public QMainWindow, public OBSERVER {
     QWidget *tripDisplayArea;
     QTableWidget *tripsTable;
 
+    // Paging Components (status views)
+    QWidget *pagingBar;
+    QPushButton *prevPageButton;
+    QPushButton *nextPageButton;
+    QLabel *pageLabel;
+
     // Header Components
     QLabel *titleLabel;
     QLabel *statsLabel;
     QPushButton *refreshButton;
+    QPushButton *validateButton;
     QPushButton *searchButton;
 
     // Action Buttons
@@ -168,6 +209,9 @@ class MainWindow : public QMainWindow, public OBSERVER {
     QPushButton *manageHostsButton;
     QPushButton *memberStatsButton;
     QPushButton *filterButton;
+    QPushButton *upcomingButton;
+    QPushButton *completedButton;
+    QPushButton *archiveButton;
     QPushButton *debugButton;
     QPushButton *addPersonButton;
     QPushButton *editPersonButton;
@@ -182,10 +226,37 @@ class MainWindow : public QMainWindow, public OBSERVER {
     QLabel *statusLabel;
     QLabel *tripCountLabel;
     QProgressBar *progressBar;
+    QPushButton *cancelTaskButton;
 
     // Data
     PERSONMANAGER *personManager;
     TRIPMANAGER *tripManager;
+    TRIPSTATISTICS *tripStatistics;
+    unique_ptr<TRIPSTORE> tripStore;
+
+    // Current view state
+    static constexpr size_t TRIPS_PAGE_SIZE = 100;
+    bool statusViewActive = false;
+    STATUS currentViewStatus = STATUS::Planned;
+    size_t currentPage = 0;
+
+    // Asynchronous startup
+    QThread *startupThread = nullptr;
+    STARTUPLOADER *startupLoader = nullptr;
+    bool startupInProgress = false;
+    bool importInProgress = false;  // Bulk import batches are redrawn and saved once at the end
+    QElapsedTimer startupTimer;
+    qint64 tripApplyMs = 0;
+
+    // Background export (one at a time; editing continues meanwhile)
+    QThread *exportThread = nullptr;
+    EXPORTJOB *exportJob = nullptr;
+
+    // Background import (batches are applied on the UI thread and undone if cancelled)
+    QThread *importThread = nullptr;
+    IMPORTJOB *importJob = nullptr;
+    IMPORTTRANSACTION *importTransaction = nullptr;
+    QElapsedTimer importTimer;
 
     // Helper function to get project path (relative to executable)
     QString getProjectPath() const {
@@ -239,9 +239,8 @@ void ManagePeopleDialog::styleComponents() {
 void ManagePeopleDialog::refreshPersonList() {
     peopleListWidget->clear();
 
-    const vector<PERSON> &allPeople = personManager->getAllPeople();
-
-    for (const PERSON &person : allPeople) {
+    // References into the manager: roles stay intact and nothing is copied
+    for (const PERSON &person : personManager->getAllPeople()) {
         QString itemText = QString("%1 - %2 (%3)")
                                .arg(QString::fromStdString(person.getID()))
                                .arg(QString::fromStdString(person.getFullName()))
@@ -308,8 +307,14 @@ void ManagePeopleDialog::onAddPersonClicked() {
     if (dialog.exec() == QDialog::Accepted) {
         PERSON *newPerson = dialog.getPersonData();
         if (newPerson) {
-            personManager->addPerson(*newPerson);
+            bool added = personManager->addPerson(*newPerson);
             delete newPerson;  // Clean up the dynamically allocated person
+            if (!added) {
+                QMessageBox::warning(this, "Integrity Check",
+                                     "The person was not added:\n\n" +
+                                         QString::fromStdString(personManager->getIntegrityGuard().describeLastIssues()));
+                return;
+            }
             refreshPersonList();
             QMessageBox::information(this, "Success", "Person added successfully!");
         }
@@ -341,7 +346,9 @@ void ManagePeopleDialog::onEditPersonClicked() {
                 refreshPersonList();
                 QMessageBox::information(this, "Success", "Person updated successfully!");
             } else {
-                QMessageBox::warning(this, "Error", "Failed to update person.");
+                QMessageBox::warning(this, "Error",
+                                     "Failed to update person.\n\n" +
+                                         QString::fromStdString(personManager->getIntegrityGuard().describeLastIssues()));
                 delete updatedPerson;
             }
         }
@@ -415,7 +422,6 @@ void ManagePeopleDialog::onImportPeopleClicked() {
     }
 
     try {
-        // Get current people to check for duplicates
         vector<MEMBER> importedMembers;
         vector<HOST> importedHosts;
 
@@ -427,31 +433,21 @@ void ManagePeopleDialog::onImportPeopleClicked() {
             return;
         }
 
-        int importCount = 0;
-
-        // Add each imported member if they don't already exist
-        for (const MEMBER &member : importedMembers) {
-            // Check if a member with the same ID already exists
-            if (!personManager->findMemberById(member.getID())) {
-                personManager->addMember(member);
-                importCount++;
-            }
-        }
-
-        // Add each imported host if they don't already exist
-        for (const HOST &host : importedHosts) {
-            // Check if a host with the same ID already exists
-            if (!personManager->findHostById(host.getID())) {
-                personManager->addHost(host);
-                importCount++;
-            }
-        }
+        // One duplicate check per row against the ID index, one notification and one cache write
+        PEOPLEIMPORTRESULT result = personManager->importPeople(move(importedMembers), move(importedHosts));
+        personManager->saveChanges();
 
         // Refresh the list
         refreshPersonList();
 
-        QMessageBox::information(this, "Import Successful",
-                                 QString("Successfully imported %1 people.").arg(importCount));
+        QString summary = QString("Successfully imported %1 people (%2 already known were skipped).")
+                              .arg(result.addedIDs.size())
+                              .arg(result.duplicateIDs.size());
+        if (!result.contactConflictIDs.empty()) {
+            summary += QString("\n%1 of them share an email or phone number with someone else.")
+                           .arg(result.contactConflictIDs.size());
+        }
+        QMessageBox::information(this, "Import Successful", summary);
 
     } catch (const std::exception &e) {
         QMessageBox::critical(this, "Import Error", QString("An error occurred during import: %1").arg(e.what()));
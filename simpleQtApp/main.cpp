@@ -1,12 +1,104 @@
 #include <QApplication>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QDir>
+#include <QStringList>
+#include <iostream>
 
+#include "Managers/BloomFilter.h"
+#include "Managers/CsvWriter.h"
+#include "Managers/DataStore.h"
+#include "Managers/DataValidator.h"
+#include "Managers/IntegrityGuard.h"
+#include "Managers/Logger.h"
 #include "UI/MainWindow.h"
 
 int main(int argc, char* argv[]) {
-    QApplication app(argc, argv);
+    // Options are read before any application object exists, so the headless commands below
+    // never need a display or a platform plugin
+    QStringList arguments;
+    for (int i = 0; i < argc; ++i) {
+        arguments << QString::fromLocal8Bit(argv[i]);
+    }
+
+    // Storage backend: --storage=csv|binary|compressed|sqlite (the binary-backed CSV cache by default)
+    for (const QString& argument : arguments) {
+        if (argument.startsWith("--storage=")) {
+            STORAGEBACKEND backend;
+            if (parseStorageBackend(argument.mid(10), backend)) {
+                selectStorageBackend(backend);
+            } else {
+                qDebug() << "Unknown storage backend" << argument.mid(10) << "- keeping the default";
+            }
+        }
+
+        // Duplicate pre-filter: --bloom-fpr=0.01 (TRIP_BLOOM_FPR, 1% by default)
+        if (argument.startsWith("--bloom-fpr=")) {
+            bool ok = false;
+            double rate = argument.mid(12).toDouble(&ok);
+            if (ok && rate > 0.0) {
+                selectBloomFalsePositiveRate(rate);
+            } else {
+                qDebug() << "Invalid false-positive rate" << argument.mid(12) << "- keeping"
+                         << selectedBloomFalsePositiveRate();
+            }
+        }
+
+        // Per-mutation integrity checks: --integrity=off|warn|strict (TRIP_INTEGRITY, warn by default)
+        if (argument.startsWith("--integrity=")) {
+            INTEGRITYMODE mode;
+            if (parseIntegrityMode(argument.mid(12), mode)) {
+                selectIntegrityMode(mode);
+            } else {
+                qDebug() << "Unknown integrity mode" << argument.mid(12) << "- keeping"
+                         << integrityModeName(selectedIntegrityMode());
+            }
+        }
 
-    MainWindow window;
-    window.show();
+        // Log level: --log-level=trace|debug|info|warning|error|off (TRIP_LOG_LEVEL, info by default)
+        if (argument.startsWith("--log-level=")) {
+            LOGLEVEL level;
+            if (parseLogLevel(argument.mid(12), level)) {
+                LOGGER::setLevel(level);
+            } else {
+                qDebug() << "Unknown log level" << argument.mid(12) << "- keeping" << logLevelName(LOGGER::getLevel());
+            }
+        }
+    }
+
+    // CSV export benchmark: --bench-csv[=trips] writes synthetic trips both ways and exits
+    for (const QString& argument : arguments) {
+        if (argument == "--bench-csv" || argument.startsWith("--bench-csv=")) {
+            QCoreApplication app(argc, argv);
+            size_t tripCount = argument.contains('=') ? argument.mid(12).toULongLong() : 200000;
+            CSVBENCHRESULT bench = benchmarkCsvExport(tripCount ? tripCount : 200000, QDir::tempPath().toStdString());
+            std::cout << "CSV export of " << bench.tripCount << " trips (" << bench.bytes << " bytes): ostream "
+                      << bench.streamMs << " ms, " << bench.streamMBps() << " MB/s; CSVWRITER " << bench.writerMs
+                      << " ms, " << bench.writerMBps() << " MB/s" << std::endl;
+            LOGGER::instance().flush();
+            return 0;
+        }
+
+        // Headless validation: --validate[=issuesPerCheck] checks the selected backend's files and exits
+        if (argument == "--validate" || argument.startsWith("--validate=")) {
+            QCoreApplication app(argc, argv);
+            size_t perCheck = argument.contains('=') ? argument.mid(11).toULongLong() : DEFAULT_ISSUES_PER_CHECK;
+            VALIDATIONREPORT report = validateStoredData(selectedStorageBackend(), perCheck);
+            std::cout << QString::fromStdString(report.summary()).trimmed().toStdString() << std::endl;
+            LOGGER::instance().flush();
+            return report.isClean() ? 0 : 1;
+        }
+    }
+
+    QApplication app(argc, argv);
+    int result = 0;
+    {
+        MainWindow window;
+        window.show();
+        result = app.exec();
+    }
 
-    return app.exec();
-}
\ No newline at end of file
+    // Whatever the managers logged while shutting down
+    LOGGER::instance().flush();
+    return result;
+}
@@ -1,4 +1,4 @@
-QT += core widgets gui
+QT += core widgets gui sql
 
 CONFIG += c++17 debug_and_release
 
@@ -18,7 +18,9 @@ SOURCES += UI/MainWindow.cpp \
     UI/EditTripDialog.cpp \
     UI/AddPersonDialog.cpp \
     UI/ManagePeopleDialog.cpp \
-    UI/EditPersonDialog.cpp
+    UI/EditPersonDialog.cpp \
+    UI/ArchiveTripModel.cpp \
+    UI/ArchiveBrowserDialog.cpp
 
 # Model files  
 SOURCES += Models/Date.cpp \
@@ -33,10 +35,31 @@ SOURCES += Models/Date.cpp \
 # Manager files
 SOURCES += Managers/FileManager.cpp \
     Managers/TripManager.cpp \
+    Managers/TripStatistics.cpp \
     Managers/Observer.cpp \
     Managers/PersonFactory.cpp \
     Managers/TripFactory.cpp \
-    Managers/PersonManager.cpp
+    Managers/PersonManager.cpp \
+    Managers/StartupLoader.cpp \
+    Managers/SnapshotFile.cpp \
+    Managers/LazyTripStore.cpp \
+    Managers/SqliteStorage.cpp \
+    Managers/DataStore.cpp \
+    Managers/DirtyTracker.cpp \
+    Managers/StreamingImport.cpp \
+    Managers/Logger.cpp \
+    Managers/CsvWriter.cpp \
+    Managers/ExportJob.cpp \
+    Managers/ImportJob.cpp \
+    Managers/BloomFilter.cpp \
+    Managers/RelationshipIndex.cpp \
+    Managers/BookingConflicts.cpp \
+    Managers/HostAvailability.cpp \
+    Managers/IdAllocator.cpp \
+    Managers/ParallelFor.cpp \
+    Managers/DataValidator.cpp \
+    Managers/IntegrityGuard.cpp \
+    Managers/TripCollection.cpp
 
 # Header files
 HEADERS += UI/MainWindow.h \
@@ -47,13 +70,36 @@ HEADERS += UI/MainWindow.h \
     UI/AddPersonDialog.h \
     UI/ManagePeopleDialog.h \
     UI/EditPersonDialog.h \
+    UI/ArchiveTripModel.h \
+    UI/ArchiveBrowserDialog.h \
     Models/header.h \
     Managers/FileManager.h \
     Managers/TripManager.h \
+    Managers/TripStatistics.h \
     Managers/Observer.h \
     Managers/PersonFactory.h \
     Managers/TripFactory.h \
-    Managers/PersonManager.h
+    Managers/PersonManager.h \
+    Managers/StartupLoader.h \
+    Managers/SnapshotFile.h \
+    Managers/LazyTripStore.h \
+    Managers/SqliteStorage.h \
+    Managers/DataStore.h \
+    Managers/DirtyTracker.h \
+    Managers/StreamingImport.h \
+    Managers/Logger.h \
+    Managers/CsvWriter.h \
+    Managers/ExportJob.h \
+    Managers/ImportJob.h \
+    Managers/BloomFilter.h \
+    Managers/RelationshipIndex.h \
+    Managers/BookingConflicts.h \
+    Managers/HostAvailability.h \
+    Managers/IdAllocator.h \
+    Managers/ParallelFor.h \
+    Managers/DataValidator.h \
+    Managers/IntegrityGuard.h \
+    Managers/TripCollection.h
 
 # Compiler definitions
 DEFINES += QT_DEPRECATED_WARNINGS